@@ -0,0 +1,18 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstdint>
+
+namespace luvk
+{
+    class LUVK_API IFrameModule
+    {
+    public:
+        virtual ~IFrameModule() = default;
+
+        virtual void BeginFrame([[maybe_unused]] std::uint32_t FrameIndex) {}
+    };
+} // namespace luvk
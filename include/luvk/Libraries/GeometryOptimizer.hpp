@@ -0,0 +1,50 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace luvk
+{
+    struct LUVK_API GeometryOptimizationArguments
+    {
+        std::span<const std::byte>     Vertices{};
+        std::uint32_t                  VertexStride{0};
+        std::uint32_t                  PositionOffset{0};
+        std::span<const std::uint32_t> Indices{};
+        bool                           VertexCache{true};
+        bool                           Overdraw{true};
+        bool                           VertexFetch{true};
+        float                          OverdrawThreshold{1.05F};
+    };
+
+    struct LUVK_API OptimizedGeometry
+    {
+        std::vector<std::byte>     Vertices{};
+        std::vector<std::uint32_t> Indices{};
+        std::uint32_t              VertexCount{0};
+
+        [[nodiscard]] constexpr bool CanUseUInt16Indices() const noexcept
+        {
+            return VertexCount <= std::numeric_limits<std::uint16_t>::max();
+        }
+    };
+
+    LUVK_API void          OptimizeVertexCache(std::span<std::uint32_t> Indices, std::uint32_t VertexCount);
+    LUVK_API void          OptimizeOverdraw(std::span<std::uint32_t>   Indices,
+                                            std::span<const std::byte> Vertices,
+                                            std::uint32_t              VertexStride,
+                                            std::uint32_t              PositionOffset = 0U,
+                                            float                      Threshold      = 1.05F);
+    LUVK_API std::uint32_t OptimizeVertexFetch(std::span<std::uint32_t> Indices, std::span<std::byte> Vertices, std::uint32_t VertexStride);
+
+    [[nodiscard]] LUVK_API OptimizedGeometry          OptimizeGeometry(const GeometryOptimizationArguments& Arguments);
+    [[nodiscard]] LUVK_API std::vector<std::uint16_t> ConvertIndicesToUInt16(std::span<const std::uint32_t> Indices);
+    [[nodiscard]] LUVK_API float                      GetAverageCacheMissRatio(std::span<const std::uint32_t> Indices, std::uint32_t VertexCount, std::uint32_t CacheSize = 16U);
+} // namespace luvk
@@ -0,0 +1,38 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+
+namespace luvk
+{
+    constexpr std::uint64_t HashSeed = 14695981039346656037ULL;
+
+    [[nodiscard]] inline std::uint64_t HashBytes(const std::span<const std::byte> Data, std::uint64_t Hash = HashSeed) noexcept
+    {
+        for (const std::byte ByteIt : Data)
+        {
+            Hash = (Hash ^ static_cast<std::uint8_t>(ByteIt)) * 1099511628211ULL;
+        }
+
+        return Hash;
+    }
+
+    template <typename Type>
+    [[nodiscard]] std::uint64_t HashSpan(const std::span<const Type> Values, const std::uint64_t Hash = HashSeed) noexcept
+    {
+        const std::size_t Count = std::size(Values);
+        return HashBytes(std::as_bytes(Values), HashBytes(std::as_bytes(std::span{&Count, 1U}), Hash));
+    }
+
+    template <typename Type>
+    [[nodiscard]] std::uint64_t HashValue(const Type& Value, const std::uint64_t Hash = HashSeed) noexcept
+    {
+        return HashBytes(std::as_bytes(std::span{&Value, 1U}), Hash);
+    }
+} // namespace luvk
@@ -0,0 +1,81 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <volk.h>
+
+namespace luvk
+{
+    enum class VertexAttribute : std::uint8_t
+    {
+        Position,
+        Normal,
+        Tangent,
+        TexCoord,
+        Color
+    };
+
+    enum class VertexEncoding : std::uint8_t
+    {
+        Float32,
+        Half,
+        Unorm16,
+        Unorm8,
+        Octahedral16,
+        Octahedral8
+    };
+
+    struct LUVK_API VertexAttributeLayout
+    {
+        VertexAttribute Attribute{VertexAttribute::Position};
+        VertexEncoding  Encoding{VertexEncoding::Float32};
+        std::uint32_t   SourceOffset{0};
+        std::uint32_t   Location{0};
+    };
+
+    struct LUVK_API VertexDequantization
+    {
+        std::array<float, 4> PositionOffset{0.F, 0.F, 0.F, 0.F};
+        std::array<float, 4> PositionScale{1.F, 1.F, 1.F, 1.F};
+        std::array<float, 4> TexCoordOffsetScale{0.F, 0.F, 1.F, 1.F};
+    };
+
+    struct LUVK_API VertexCompressionArguments
+    {
+        std::span<const std::byte>             Vertices{};
+        std::uint32_t                          VertexStride{0};
+        std::span<const VertexAttributeLayout> Attributes{};
+        std::uint32_t                          Binding{0};
+    };
+
+    struct LUVK_API CompressedVertices
+    {
+        std::vector<std::byte>                         Data{};
+        std::uint32_t                                  VertexCount{0};
+        VertexDequantization                           Dequantization{};
+        VkVertexInputBindingDescription                Binding{};
+        std::vector<VkVertexInputAttributeDescription> Attributes{};
+    };
+
+    [[nodiscard]] LUVK_API VkFormat      GetVertexFormat(VertexAttribute Attribute, VertexEncoding Encoding);
+    [[nodiscard]] LUVK_API std::uint32_t GetVertexEncodingSize(VertexAttribute Attribute, VertexEncoding Encoding);
+
+    [[nodiscard]] LUVK_API VkVertexInputBindingDescription                GetVertexBindingDescription(std::span<const VertexAttributeLayout> Attributes,
+                                                                                                      std::uint32_t                          Binding   = 0U,
+                                                                                                      VkVertexInputRate                      InputRate = VK_VERTEX_INPUT_RATE_VERTEX);
+    [[nodiscard]] LUVK_API std::vector<VkVertexInputAttributeDescription> GetVertexAttributeDescriptions(std::span<const VertexAttributeLayout> Attributes, std::uint32_t Binding = 0U);
+
+    [[nodiscard]] LUVK_API CompressedVertices CompressVertices(const VertexCompressionArguments& Arguments);
+
+    [[nodiscard]] LUVK_API std::uint16_t        FloatToHalf(float Value) noexcept;
+    [[nodiscard]] LUVK_API float                HalfToFloat(std::uint16_t Value) noexcept;
+    [[nodiscard]] LUVK_API std::array<float, 2> EncodeOctahedral(const std::array<float, 3>& Direction) noexcept;
+    [[nodiscard]] LUVK_API std::array<float, 3> DecodeOctahedral(const std::array<float, 2>& Encoded) noexcept;
+} // namespace luvk
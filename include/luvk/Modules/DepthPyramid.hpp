@@ -0,0 +1,114 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+#include "luvk/Modules/InstanceCulling.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class CommandRecorder;
+    class DescriptorPool;
+    class DescriptorSet;
+    class Device;
+    class Draw;
+    class Image;
+    class Memory;
+    class Pipeline;
+    class Sampler;
+    class SwapChain;
+
+    class LUVK_API DepthPyramid : public IRenderModule,
+                                  public IFrameModule
+    {
+    public:
+        static constexpr std::uint32_t MaxMipCount = 13U;
+
+    protected:
+        struct Readback
+        {
+            bool                    Pending{false};
+            std::array<float, 16>   ViewProjection{};
+            std::shared_ptr<Buffer> Data{};
+        };
+
+        bool                                                              m_ReverseDepth{false};
+        bool                                                              m_Initialized{false};
+        std::uint32_t                                                     m_FrameIndex{0};
+        std::uint32_t                                                     m_ReadbackSize{0};
+        std::uint32_t                                                     m_ReadbackLevel{0};
+        VkExtent2D                                                        m_ReadbackExtent{0U, 0U};
+        VkExtent2D                                                        m_SourceExtent{0U, 0U};
+        std::array<std::weak_ptr<Image>, Constants::ImageCount>           m_SourceImages{};
+        std::vector<float>                                                m_HostPyramid{};
+        std::array<float, 16>                                             m_HostViewProjection{};
+        std::array<std::array<float, 16>, Constants::ImageCount>          m_ViewProjections{};
+        std::array<Readback, Constants::ImageCount>                       m_Readbacks{};
+        std::array<std::shared_ptr<DescriptorSet>, Constants::ImageCount> m_Sets{};
+        std::shared_ptr<Image>                                            m_Pyramid{};
+        std::shared_ptr<Sampler>                                          m_Sampler{};
+        std::shared_ptr<Buffer>                                           m_Counter{};
+        std::shared_ptr<Pipeline>                                         m_Pipeline{};
+        std::shared_ptr<Device>                                           m_DeviceModule{};
+        std::shared_ptr<Memory>                                           m_MemoryModule{};
+        std::shared_ptr<DescriptorPool>                                   m_PoolModule{};
+        std::shared_ptr<SwapChain>                                        m_SwapChainModule{};
+        std::shared_ptr<Draw>                                             m_DrawModule{};
+
+    public:
+        DepthPyramid() = delete;
+        explicit DepthPyramid(const std::shared_ptr<Device>&         DeviceModule,
+                              const std::shared_ptr<Memory>&         MemoryModule,
+                              const std::shared_ptr<DescriptorPool>& PoolModule,
+                              const std::shared_ptr<SwapChain>&      SwapChainModule,
+                              const std::shared_ptr<Draw>&           DrawModule);
+
+        ~DepthPyramid() override
+        {
+            DepthPyramid::ClearResources();
+        }
+
+        struct CreationArguments
+        {
+            std::span<const std::uint32_t> Shader{};
+            bool                           ReverseDepth{false};
+            std::uint32_t                  ReadbackSize{128U};
+        };
+
+        void CreatePyramid(const CreationArguments& Arguments);
+        void RecordPyramid(CommandRecorder& Recorder);
+        void SetViewProjection(const std::array<float, 16>& ViewProjection);
+
+        void BeginFrame(std::uint32_t FrameIndex) override;
+
+        [[nodiscard]] bool                              IsVisible(const InstanceCulling::InstanceBounds& Bounds) const noexcept;
+        [[nodiscard]] InstanceCulling::DepthPyramidInfo GetPyramidInfo() const noexcept;
+
+        [[nodiscard]] constexpr bool IsReverseDepth() const noexcept
+        {
+            return m_ReverseDepth;
+        }
+
+        [[nodiscard]] std::shared_ptr<Image> GetPyramid() const noexcept
+        {
+            return m_Pyramid;
+        }
+
+    protected:
+        void               CreateTargets();
+        [[nodiscard]] bool IsSourceOutdated() const noexcept;
+
+        void ClearResources() override;
+    };
+} // namespace luvk
@@ -4,19 +4,37 @@
 
 #pragma once
 
+#include <array>
+#include <mutex>
 #include <span>
+#include <vector>
 #include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
 #include "luvk/Interfaces/IRenderModule.hpp"
 
 namespace luvk
 {
     class Device;
 
-    class LUVK_API DescriptorPool : public IRenderModule
+    class LUVK_API DescriptorPool : public IRenderModule,
+                                    public IFrameModule
     {
     protected:
-        VkDescriptorPool        m_Pool{VK_NULL_HANDLE};
-        std::shared_ptr<Device> m_DeviceModule{};
+        struct TransientPages
+        {
+            std::vector<VkDescriptorPool> Pools{};
+            std::size_t                   Current{0};
+        };
+
+        std::uint32_t                                     m_MaxSets{0};
+        std::uint32_t                                     m_NextMaxSets{0};
+        VkDescriptorPoolCreateFlags                       m_Flags{0};
+        std::vector<VkDescriptorPoolSize>                 m_PoolSizes{};
+        std::vector<VkDescriptorPool>                     m_Pools{};
+        std::array<TransientPages, Constants::ImageCount> m_TransientPools{};
+        std::mutex                                        m_Mutex{};
+        std::shared_ptr<Device>                           m_DeviceModule{};
 
     public:
         DescriptorPool() = delete;
@@ -31,12 +49,31 @@ namespace luvk
                                   std::span<const VkDescriptorPoolSize> PoolSizes,
                                   VkDescriptorPoolCreateFlags           Flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
 
-        [[nodiscard]] constexpr VkDescriptorPool GetHandle() const noexcept
+        [[nodiscard]] VkDescriptorPool Allocate(VkDescriptorSetLayout Layout, VkDescriptorSet& Set);
+        [[nodiscard]] VkDescriptorSet  AllocateTransient(VkDescriptorSetLayout Layout, std::uint32_t FrameIndex);
+
+        void Free(VkDescriptorPool Pool, VkDescriptorSet Set);
+        void ResetTransient(std::uint32_t FrameIndex);
+
+        void BeginFrame(const std::uint32_t FrameIndex) override
         {
-            return m_Pool;
+            ResetTransient(FrameIndex);
+        }
+
+        [[nodiscard]] VkDescriptorPool GetHandle() const noexcept
+        {
+            return std::empty(m_Pools) ? VK_NULL_HANDLE : m_Pools.back();
+        }
+
+        [[nodiscard]] constexpr bool CanFreeSets() const noexcept
+        {
+            return (m_Flags & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT) != 0U;
         }
 
     protected:
         void ClearResources() override;
+
+    private:
+        [[nodiscard]] VkDescriptorPool CreatePage(std::uint32_t MaxSets, VkDescriptorPoolCreateFlags Flags) const;
     };
 } // namespace luvk
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <span>
 #include <unordered_map>
@@ -40,6 +41,7 @@ namespace luvk
         VkPhysicalDeviceVulkan12Features                        m_Vulkan12Features{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES};
         VkPhysicalDeviceVulkan13Features                        m_Vulkan13Features{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES};
         VkPhysicalDeviceVulkan14Features                        m_Vulkan14Features{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES};
+        VkPhysicalDeviceBufferDeviceAddressFeatures             m_BufferDeviceAddressFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES};
         VkPhysicalDeviceProperties                              m_DeviceProperties{};
         std::vector<VkPhysicalDevice>                           m_AvailableDevices{};
         std::vector<VkSurfaceFormatKHR>                         m_SurfaceFormat{};
@@ -91,6 +93,13 @@ namespace luvk
             return m_DeviceProperties.apiVersion;
         }
 
+        [[nodiscard]] std::uint32_t GetEffectiveApiVersion() const noexcept;
+        [[nodiscard]] bool          HasFeatureStructure(VkStructureType Type) const noexcept;
+        [[nodiscard]] bool          SupportsPushDescriptors() const noexcept;
+        [[nodiscard]] bool          SupportsBufferDeviceAddress() const noexcept;
+        [[nodiscard]] bool          SupportsDrawIndirectCount() const noexcept;
+        [[nodiscard]] bool          SupportsPipelineCreationFeedback() const noexcept;
+
         [[nodiscard]] constexpr const VkPhysicalDeviceFeatures2& GetDeviceFeatures() const noexcept
         {
             return m_DeviceFeatures;
@@ -147,6 +156,7 @@ namespace luvk
         void WaitIdle() const;
         void Wait(VkQueue Queue) const;
         void Wait(VkFence Fence, VkBool32 WaitAll = VK_TRUE, std::uint64_t Timeout = UINT64_MAX) const;
+        void SubmitImmediate(const std::function<void(VkCommandBuffer)>& Record) const;
 
     protected:
         void InitializeResources() override;
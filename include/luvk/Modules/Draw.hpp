@@ -10,6 +10,7 @@
 #include <vector>
 #include <volk.h>
 #include "luvk/Interfaces/IRenderModule.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
 
 namespace luvk
 {
@@ -20,7 +21,7 @@ namespace luvk
 
     struct LUVK_API DrawCallbackInfo
     {
-        std::function<bool(VkCommandBuffer)> Callback;
+        std::function<bool(CommandRecorder&)> Callback;
     };
 
     class LUVK_API Draw : public IRenderModule
@@ -32,6 +33,9 @@ namespace luvk
         std::vector<DrawCallbackInfo> m_PreRenderCallbacks{};
         std::vector<DrawCallbackInfo> m_DrawCallbacks{};
         std::vector<DrawCallbackInfo> m_PostRenderCallbacks{};
+        std::vector<DrawCallbackInfo> m_PostPassCallbacks{};
+
+        std::uint32_t m_CurrentImageIndex{0};
 
         std::shared_ptr<Device>          m_DeviceModule{};
         std::shared_ptr<SwapChain>       m_SwapChainModule{};
@@ -70,6 +74,16 @@ namespace luvk
             m_PostRenderCallbacks.emplace_back(std::move(Cmd));
         }
 
+        void RegisterPostPassCommand(DrawCallbackInfo&& Cmd)
+        {
+            m_PostPassCallbacks.emplace_back(std::move(Cmd));
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetCurrentImageIndex() const noexcept
+        {
+            return m_CurrentImageIndex;
+        }
+
         void RecordCommands(const FrameData& Frame, std::uint32_t ImageIndex);
         void SubmitFrame(FrameData& Frame, std::uint32_t ImageIndex) const;
     };
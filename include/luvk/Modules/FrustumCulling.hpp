@@ -0,0 +1,83 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class ThreadPool;
+
+    class LUVK_API FrustumCulling : public IRenderModule
+    {
+    public:
+        using Planes = std::array<std::array<float, 4>, 6>;
+
+        static constexpr std::uint32_t BlockSize = 8U;
+
+    protected:
+        std::vector<float>          m_CenterX{};
+        std::vector<float>          m_CenterY{};
+        std::vector<float>          m_CenterZ{};
+        std::vector<float>          m_Radius{};
+        std::vector<float>          m_ExtentX{};
+        std::vector<float>          m_ExtentY{};
+        std::vector<float>          m_ExtentZ{};
+        std::vector<std::uint32_t>  m_Visible{};
+        std::uint32_t               m_VisibleCount{0};
+        std::vector<std::uint32_t>  m_TaskCounts{};
+        std::uint32_t               m_MinObjectsPerTask{16384U};
+        std::shared_ptr<ThreadPool> m_ThreadPoolModule{};
+
+    public:
+        FrustumCulling() = delete;
+        explicit FrustumCulling(const std::shared_ptr<ThreadPool>& ThreadPoolModule);
+
+        ~FrustumCulling() override
+        {
+            FrustumCulling::ClearResources();
+        }
+
+        void Reserve(std::size_t Count);
+        void Clear() noexcept;
+
+        std::uint32_t AddSphere(const std::array<float, 3>& Center, float Radius);
+        std::uint32_t AddBox(const std::array<float, 3>& Center, const std::array<float, 3>& Extents);
+
+        void SetSphere(std::uint32_t Index, const std::array<float, 3>& Center, float Radius);
+        void SetBox(std::uint32_t Index, const std::array<float, 3>& Center, const std::array<float, 3>& Extents);
+
+        std::span<const std::uint32_t> Cull(const Planes& Frustum);
+
+        void SetMinObjectsPerTask(const std::uint32_t Count) noexcept
+        {
+            m_MinObjectsPerTask = std::max(Count, BlockSize);
+        }
+
+        [[nodiscard]] constexpr std::span<const std::uint32_t> GetVisible() const noexcept
+        {
+            return {std::data(m_Visible), m_VisibleCount};
+        }
+
+        [[nodiscard]] constexpr std::size_t GetCount() const noexcept
+        {
+            return std::size(m_Radius);
+        }
+
+        [[nodiscard]] static std::string_view GetBackendName() noexcept;
+
+    protected:
+        void ClearResources() override;
+
+        [[nodiscard]] std::uint32_t CullRange(const Planes& Frustum, std::uint32_t Begin, std::uint32_t End, std::uint32_t* Output) const noexcept;
+    };
+} // namespace luvk
@@ -0,0 +1,128 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class CommandRecorder;
+    class DescriptorPool;
+    class DescriptorSet;
+    class Device;
+    class GeometryBuffer;
+    class Material;
+    class Memory;
+    class Pipeline;
+
+    class LUVK_API IndirectDraw : public IRenderModule,
+                                  public IFrameModule
+    {
+    public:
+        struct DrawRecord
+        {
+            std::uint32_t FirstIndex{0};
+            std::uint32_t IndexCount{0};
+            std::int32_t  VertexOffset{0};
+            std::uint32_t InstanceIndex{0};
+            std::uint32_t Bucket{0};
+            std::uint32_t Visible{1};
+            std::uint32_t Reserved0{0};
+            std::uint32_t Reserved1{0};
+        };
+
+        struct BucketInfo
+        {
+            std::shared_ptr<Material>       MaterialObj{};
+            std::shared_ptr<GeometryBuffer> Geometry{};
+            std::shared_ptr<Buffer>         InstanceBuffer{};
+            std::uint32_t                   InstanceStride{0};
+            std::uint32_t                   MaxDraws{0};
+        };
+
+    protected:
+        struct FrameResources
+        {
+            std::uint32_t                  RecordCount{0};
+            std::vector<std::uint32_t>     SlotInstances{};
+            std::shared_ptr<Buffer>        Records{};
+            std::shared_ptr<Buffer>        Commands{};
+            std::shared_ptr<Buffer>        Counts{};
+            std::shared_ptr<DescriptorSet> Set{};
+        };
+
+        bool                                              m_UseDrawCount{false};
+        bool                                              m_MultiDrawIndirect{false};
+        bool                                              m_FirstInstance{false};
+        std::uint32_t                                     m_FrameIndex{0};
+        std::uint32_t                                     m_MaxRecords{0};
+        std::uint32_t                                     m_TotalDraws{0};
+        std::vector<BucketInfo>                           m_Buckets{};
+        std::vector<std::uint32_t>                        m_BucketOffsets{};
+        std::shared_ptr<Buffer>                           m_BucketBuffer{};
+        std::array<FrameResources, Constants::ImageCount> m_Frames{};
+        std::shared_ptr<Pipeline>                         m_CompactionPipeline{};
+        std::shared_ptr<Device>                           m_DeviceModule{};
+        std::shared_ptr<Memory>                           m_MemoryModule{};
+        std::shared_ptr<DescriptorPool>                   m_PoolModule{};
+
+    public:
+        IndirectDraw() = delete;
+        explicit IndirectDraw(const std::shared_ptr<Device>&         DeviceModule,
+                              const std::shared_ptr<Memory>&         MemoryModule,
+                              const std::shared_ptr<DescriptorPool>& PoolModule);
+
+        ~IndirectDraw() override
+        {
+            IndirectDraw::ClearResources();
+        }
+
+        struct CreationArguments
+        {
+            std::uint32_t                  MaxRecords{0};
+            std::span<const std::uint32_t> CompactionShader{};
+        };
+
+        [[nodiscard]] std::uint32_t AddBucket(const BucketInfo& Info);
+
+        void CreateIndirectDraw(const CreationArguments& Arguments);
+        void SetRecords(std::span<const DrawRecord> Records, std::uint32_t FrameIndex);
+
+        void RecordCompaction(CommandRecorder& Recorder) const;
+        void RecordDraws(CommandRecorder& Recorder) const;
+
+        void BeginFrame(const std::uint32_t FrameIndex) override
+        {
+            m_FrameIndex = FrameIndex;
+        }
+
+        [[nodiscard]] std::shared_ptr<Buffer> GetRecordBuffer(const std::uint32_t FrameIndex) const noexcept
+        {
+            return FrameIndex < Constants::ImageCount ? m_Frames.at(FrameIndex).Records : nullptr;
+        }
+
+        [[nodiscard]] std::uint32_t GetRecordCount(const std::uint32_t FrameIndex) const noexcept
+        {
+            return FrameIndex < Constants::ImageCount ? m_Frames.at(FrameIndex).RecordCount : 0U;
+        }
+
+        [[nodiscard]] constexpr std::span<const BucketInfo> GetBuckets() const noexcept
+        {
+            return m_Buckets;
+        }
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
@@ -0,0 +1,150 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class CommandRecorder;
+    class DescriptorPool;
+    class DescriptorSet;
+    class Device;
+    class Memory;
+    class Pipeline;
+
+    class LUVK_API InstanceCulling : public IRenderModule,
+                                     public IFrameModule
+    {
+    public:
+        enum class BoundsShape : std::uint32_t
+        {
+            Sphere,
+            Box
+        };
+
+        struct InstanceBounds
+        {
+            std::array<float, 3> Center{0.F, 0.F, 0.F};
+            float                Radius{0.F};
+            std::array<float, 3> Extents{0.F, 0.F, 0.F};
+            BoundsShape          Shape{BoundsShape::Sphere};
+        };
+
+        struct ViewInfo
+        {
+            std::array<std::array<float, 4>, 6> FrustumPlanes{};
+            std::array<float, 16>               OcclusionViewProjection{};
+        };
+
+        struct DepthPyramidInfo
+        {
+            VkImageView   View{VK_NULL_HANDLE};
+            VkSampler     Sampler{VK_NULL_HANDLE};
+            VkImageLayout Layout{VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+            VkExtent2D    Extent{0U, 0U};
+            std::uint32_t MipCount{0};
+            bool          ReverseDepth{false};
+        };
+
+        struct TargetInfo
+        {
+            VkBuffer      SourceInstances{VK_NULL_HANDLE};
+            std::uint32_t InstanceStride{0};
+            std::uint32_t ElementCount{0};
+            bool          Indexed{true};
+        };
+
+    protected:
+        struct TargetFrame
+        {
+            TargetInfo                     Info{};
+            std::uint32_t                  InstanceCount{0};
+            std::uint32_t                  Capacity{0};
+            std::shared_ptr<Buffer>        Bounds{};
+            std::shared_ptr<Buffer>        Compacted{};
+            std::shared_ptr<Buffer>        Indices{};
+            std::shared_ptr<Buffer>        Command{};
+            std::shared_ptr<DescriptorSet> Set{};
+        };
+
+        struct Target
+        {
+            bool                                           Active{false};
+            std::array<TargetFrame, Constants::ImageCount> Frames{};
+        };
+
+        std::uint32_t                                              m_FrameIndex{0};
+        DepthPyramidInfo                                           m_Pyramid{};
+        std::vector<Target>                                        m_Targets{};
+        std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_ViewBuffers{};
+        std::shared_ptr<DescriptorSet>                             m_LayoutOwner{};
+        std::shared_ptr<Pipeline>                                  m_FrustumPipeline{};
+        std::shared_ptr<Pipeline>                                  m_OcclusionPipeline{};
+        std::shared_ptr<Device>                                    m_DeviceModule{};
+        std::shared_ptr<Memory>                                    m_MemoryModule{};
+        std::shared_ptr<DescriptorPool>                            m_PoolModule{};
+
+    public:
+        InstanceCulling() = delete;
+        explicit InstanceCulling(const std::shared_ptr<Device>&         DeviceModule,
+                                 const std::shared_ptr<Memory>&         MemoryModule,
+                                 const std::shared_ptr<DescriptorPool>& PoolModule);
+
+        ~InstanceCulling() override
+        {
+            InstanceCulling::ClearResources();
+        }
+
+        struct CreationArguments
+        {
+            std::span<const std::uint32_t> FrustumShader{};
+            std::span<const std::uint32_t> OcclusionShader{};
+        };
+
+        void CreateCulling(const CreationArguments& Arguments);
+
+        [[nodiscard]] std::uint32_t RegisterTarget();
+        void                        ReleaseTarget(std::uint32_t TargetIndex);
+
+        void SetTargetInstances(std::uint32_t TargetIndex, std::uint32_t FrameIndex, const TargetInfo& Info, std::span<const InstanceBounds> Bounds);
+        void SetView(const ViewInfo& View, std::uint32_t FrameIndex) const;
+        void SetDepthPyramid(const DepthPyramidInfo& Pyramid);
+
+        void RecordCulling(CommandRecorder& Recorder) const;
+
+        void BeginFrame(const std::uint32_t FrameIndex) override
+        {
+            m_FrameIndex = FrameIndex;
+        }
+
+        [[nodiscard]] static std::array<std::array<float, 4>, 6> ExtractFrustumPlanes(const std::array<float, 16>& ViewProjection) noexcept;
+
+        [[nodiscard]] bool IsTargetReady(std::uint32_t TargetIndex, std::uint32_t FrameIndex) const noexcept;
+
+        [[nodiscard]] std::shared_ptr<Buffer> GetCompactedInstances(std::uint32_t TargetIndex, std::uint32_t FrameIndex) const;
+        [[nodiscard]] std::shared_ptr<Buffer> GetVisibleIndices(std::uint32_t TargetIndex, std::uint32_t FrameIndex) const;
+        [[nodiscard]] std::shared_ptr<Buffer> GetDrawCommand(std::uint32_t TargetIndex, std::uint32_t FrameIndex) const;
+
+        [[nodiscard]] bool HasDepthPyramid() const noexcept
+        {
+            return m_Pyramid.View != VK_NULL_HANDLE && m_OcclusionPipeline != nullptr;
+        }
+
+    protected:
+        void ClearResources() override;
+
+        void ResizeTarget(TargetFrame& Frame, std::uint32_t FrameIndex, std::uint32_t InstanceCount, std::uint32_t InstanceStride);
+    };
+} // namespace luvk
@@ -7,6 +7,8 @@
 #include <memory>
 #include <vk_mem_alloc.h>
 #include "luvk/Interfaces/IEventModule.hpp"
+#include "luvk/Interfaces/IExtensionsModule.hpp"
+#include "luvk/Interfaces/IFeatureChainModule.hpp"
 #include "luvk/Interfaces/IRenderModule.hpp"
 
 namespace luvk
@@ -21,13 +23,22 @@ namespace luvk
     };
 
     class LUVK_API Memory : public IRenderModule,
-                            public IEventModule
+                            public IEventModule,
+                            public IExtensionsModule,
+                            public IFeatureChainModule
     {
     protected:
         VmaAllocator              m_Allocator{VK_NULL_HANDLE};
+        VmaAllocatorCreateFlags   m_AllocatorFlags{0};
         std::shared_ptr<Device>   m_DeviceModule{};
         std::shared_ptr<Renderer> m_RendererModule{};
 
+        mutable VkPhysicalDeviceMemoryPriorityFeaturesEXT m_MemoryPriorityFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT,
+                                                                                   .memoryPriority = VK_TRUE};
+        mutable VkPhysicalDeviceCoherentMemoryFeaturesAMD m_CoherentMemoryFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD};
+        mutable VkPhysicalDeviceMaintenance4Features      m_Maintenance4Features{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES};
+        mutable VkPhysicalDeviceMaintenance5FeaturesKHR   m_Maintenance5Features{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES_KHR};
+
     public:
         Memory() = delete;
         explicit Memory(const std::shared_ptr<Renderer>& RendererModule, const std::shared_ptr<Device>& DeviceModule);
@@ -37,6 +48,13 @@ namespace luvk
             Memory::ClearResources();
         }
 
+        [[nodiscard]] ExtensionMap GetDeviceExtensions() const noexcept override
+        {
+            return {{"", {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME}}};
+        }
+
+        [[nodiscard]] const void* GetDeviceFeatureChain() const noexcept override;
+
         void InitializeAllocator(VmaAllocatorCreateFlags Flags);
 
         [[nodiscard]] constexpr VmaAllocator GetAllocator() const noexcept
@@ -44,7 +62,13 @@ namespace luvk
             return m_Allocator;
         }
 
+        [[nodiscard]] constexpr VmaAllocatorCreateFlags GetAllocatorFlags() const noexcept
+        {
+            return m_AllocatorFlags;
+        }
+
     protected:
-        void ClearResources() override;
+        [[nodiscard]] VmaAllocatorCreateFlags GetSupportedAllocatorFlags() const;
+        void                                  ClearResources() override;
     };
 } // namespace luvk
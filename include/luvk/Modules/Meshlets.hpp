@@ -0,0 +1,171 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IExtensionsModule.hpp"
+#include "luvk/Interfaces/IFeatureChainModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class CommandRecorder;
+    class DescriptorPool;
+    class DescriptorSet;
+    class Device;
+    class Memory;
+    class Pipeline;
+
+    class LUVK_API Meshlets : public IRenderModule,
+                              public IExtensionsModule,
+                              public IFeatureChainModule
+    {
+    public:
+        static constexpr std::uint32_t GroupSize    = 32U;
+        static constexpr std::uint32_t MaxVertices  = 64U;
+        static constexpr std::uint32_t MaxTriangles = 124U;
+
+        struct Meshlet
+        {
+            std::uint32_t        VertexOffset{0};
+            std::uint32_t        TriangleOffset{0};
+            std::uint32_t        VertexCount{0};
+            std::uint32_t        TriangleCount{0};
+            std::array<float, 3> Center{0.F, 0.F, 0.F};
+            float                Radius{0.F};
+            std::array<float, 3> ConeApex{0.F, 0.F, 0.F};
+            float                ConeCutoff{1.F};
+            std::array<float, 3> ConeAxis{0.F, 0.F, 0.F};
+            float                Padding{0.F};
+        };
+
+        struct MeshletData
+        {
+            std::vector<Meshlet>       Meshlets{};
+            std::vector<std::uint32_t> Vertices{};
+            std::vector<std::uint32_t> Triangles{};
+        };
+
+        struct BuildArguments
+        {
+            std::span<const std::byte>     Vertices{};
+            std::uint32_t                  VertexStride{sizeof(float) * 3U};
+            std::uint32_t                  PositionOffset{0};
+            std::span<const std::uint32_t> Indices{};
+            std::uint32_t                  MaxVertices{Meshlets::MaxVertices};
+            std::uint32_t                  MaxTriangles{Meshlets::MaxTriangles};
+        };
+
+        struct ViewInfo
+        {
+            std::array<float, 16>               ViewProjection{};
+            std::array<std::array<float, 4>, 6> FrustumPlanes{};
+            std::array<float, 4>                CameraPosition{};
+        };
+
+    protected:
+        struct Geometry
+        {
+            bool                                                              Active{false};
+            std::uint32_t                                                     MeshletCount{0};
+            std::uint32_t                                                     VertexStride{0};
+            std::uint32_t                                                     PositionOffset{0};
+            std::shared_ptr<Buffer>                                           Meshlets{};
+            std::shared_ptr<Buffer>                                           MeshletVertices{};
+            std::shared_ptr<Buffer>                                           MeshletTriangles{};
+            std::shared_ptr<Buffer>                                           Vertices{};
+            std::array<std::shared_ptr<DescriptorSet>, Constants::ImageCount> Sets{};
+        };
+
+        std::uint32_t                                              m_SetIndex{1};
+        std::vector<std::uint32_t>                                 m_TaskShader{};
+        std::vector<std::uint32_t>                                 m_MeshShader{};
+        std::vector<Geometry>                                      m_Geometries{};
+        std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_ViewBuffers{};
+        std::shared_ptr<DescriptorSet>                             m_LayoutOwner{};
+        std::shared_ptr<Device>                                    m_DeviceModule{};
+        std::shared_ptr<Memory>                                    m_MemoryModule{};
+        std::shared_ptr<DescriptorPool>                            m_PoolModule{};
+
+        VkPhysicalDeviceMeshShaderFeaturesEXT m_MeshShaderFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT,
+                                                                   .taskShader = VK_TRUE,
+                                                                   .meshShader = VK_TRUE};
+
+    public:
+        Meshlets() = delete;
+        explicit Meshlets(const std::shared_ptr<Device>&         DeviceModule,
+                          const std::shared_ptr<Memory>&         MemoryModule,
+                          const std::shared_ptr<DescriptorPool>& PoolModule);
+
+        ~Meshlets() override
+        {
+            Meshlets::ClearResources();
+        }
+
+        [[nodiscard]] ExtensionMap GetDeviceExtensions() const noexcept override
+        {
+            return {{"", {VK_EXT_MESH_SHADER_EXTENSION_NAME}}};
+        }
+
+        [[nodiscard]] const void* GetDeviceFeatureChain() const noexcept override;
+
+        struct CreationArguments
+        {
+            std::span<const std::uint32_t> TaskShader{};
+            std::span<const std::uint32_t> MeshShader{};
+            std::uint32_t                  SetIndex{1};
+        };
+
+        void CreateMeshlets(const CreationArguments& Arguments);
+
+        [[nodiscard]] static MeshletData BuildMeshlets(const BuildArguments& Arguments);
+
+        [[nodiscard]] std::uint32_t RegisterGeometry(const MeshletData& Data, std::span<const std::byte> Vertices, std::uint32_t VertexStride, std::uint32_t PositionOffset = 0U);
+        void                        ReleaseGeometry(std::uint32_t GeometryIndex);
+
+        void SetView(const ViewInfo& View, std::uint32_t FrameIndex) const;
+
+        void RecordDraw(CommandRecorder&             Recorder,
+                        std::uint32_t                GeometryIndex,
+                        const Pipeline&              MeshPipeline,
+                        const std::array<float, 16>& Model,
+                        std::uint32_t                FrameIndex) const;
+
+        [[nodiscard]] VkDescriptorSetLayout GetSetLayout() const noexcept;
+
+        [[nodiscard]] static constexpr VkPushConstantRange GetPushConstantRange() noexcept
+        {
+            return {.stageFlags = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT, .offset = 0, .size = sizeof(float) * 16U + sizeof(std::uint32_t) * 4U};
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetSetIndex() const noexcept
+        {
+            return m_SetIndex;
+        }
+
+        [[nodiscard]] constexpr std::span<const std::uint32_t> GetTaskShader() const noexcept
+        {
+            return m_TaskShader;
+        }
+
+        [[nodiscard]] constexpr std::span<const std::uint32_t> GetMeshShader() const noexcept
+        {
+            return m_MeshShader;
+        }
+
+        [[nodiscard]] std::uint32_t GetMeshletCount(std::uint32_t GeometryIndex) const;
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
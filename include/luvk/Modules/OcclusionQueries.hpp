@@ -0,0 +1,114 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IExtensionsModule.hpp"
+#include "luvk/Interfaces/IFeatureChainModule.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+#include "luvk/Modules/InstanceCulling.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class CommandRecorder;
+    class Device;
+    class Draw;
+    class Memory;
+    class Pipeline;
+    class SwapChain;
+
+    class LUVK_API OcclusionQueries : public IRenderModule,
+                                      public IFrameModule,
+                                      public IExtensionsModule,
+                                      public IFeatureChainModule,
+                                      public std::enable_shared_from_this<OcclusionQueries>
+    {
+    public:
+        using ProxyCallback = std::function<void(CommandRecorder&)>;
+
+    protected:
+        struct FrameQueries
+        {
+            VkQueryPool                Pool{VK_NULL_HANDLE};
+            std::shared_ptr<Buffer>    Predicates{};
+            std::vector<std::uint32_t> Issued{};
+        };
+
+        std::uint32_t                                   m_FrameIndex{0};
+        std::uint32_t                                   m_MaxQueries{0};
+        std::array<float, 16>                           m_ViewProjection{};
+        std::vector<bool>                               m_Active{};
+        std::vector<std::uint32_t>                      m_PendingReset{};
+        std::array<FrameQueries, Constants::ImageCount> m_Frames{};
+        std::shared_ptr<Pipeline>                       m_ProxyPipeline{};
+        std::shared_ptr<Device>                         m_DeviceModule{};
+        std::shared_ptr<Memory>                         m_MemoryModule{};
+        std::shared_ptr<SwapChain>                      m_SwapChainModule{};
+
+        VkPhysicalDeviceConditionalRenderingFeaturesEXT m_ConditionalRenderingFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT,
+                                                                                       .conditionalRendering = VK_TRUE};
+
+    public:
+        OcclusionQueries() = delete;
+        explicit OcclusionQueries(const std::shared_ptr<Device>&    DeviceModule,
+                                  const std::shared_ptr<Memory>&    MemoryModule,
+                                  const std::shared_ptr<SwapChain>& SwapChainModule);
+
+        ~OcclusionQueries() override
+        {
+            OcclusionQueries::ClearResources();
+        }
+
+        [[nodiscard]] ExtensionMap GetDeviceExtensions() const noexcept override
+        {
+            return {{"", {VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME}}};
+        }
+
+        [[nodiscard]] const void* GetDeviceFeatureChain() const noexcept override;
+
+        struct CreationArguments
+        {
+            std::uint32_t                  MaxQueries{1024U};
+            std::span<const std::uint32_t> VertexShader{};
+            std::span<const std::uint32_t> FragmentShader{};
+            bool                           ReverseDepth{false};
+        };
+
+        void CreateQueries(const CreationArguments& Arguments);
+
+        [[nodiscard]] std::uint32_t RegisterQuery();
+        void                        ReleaseQuery(std::uint32_t Query);
+
+        void SetViewProjection(const std::array<float, 16>& ViewProjection);
+        void RegisterCommands(Draw& DrawModule);
+
+        void RecordReset(CommandRecorder& Recorder);
+        void RecordProxy(CommandRecorder& Recorder, std::uint32_t Query, const InstanceCulling::InstanceBounds& Bounds);
+        void RecordProxy(CommandRecorder& Recorder, std::uint32_t Query, const ProxyCallback& Proxy);
+        void RecordResolve(CommandRecorder& Recorder);
+
+        bool BeginConditional(CommandRecorder& Recorder, std::uint32_t Query) const;
+        void EndConditional(CommandRecorder& Recorder) const;
+
+        void BeginFrame(const std::uint32_t FrameIndex) override
+        {
+            m_FrameIndex = FrameIndex;
+        }
+
+        [[nodiscard]] bool SupportsConditionalRendering() const noexcept;
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
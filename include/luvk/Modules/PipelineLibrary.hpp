@@ -0,0 +1,83 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <volk.h>
+#include "luvk/Interfaces/IExtensionsModule.hpp"
+#include "luvk/Interfaces/IFeatureChainModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+
+namespace luvk
+{
+    class Device;
+    class ThreadPool;
+
+    class LUVK_API PipelineLibrary : public IRenderModule,
+                                     public IExtensionsModule,
+                                     public IFeatureChainModule
+    {
+    protected:
+        struct PendingPipeline
+        {
+            std::weak_ptr<Pipeline> Target{};
+            VkPipeline              Linked{VK_NULL_HANDLE};
+            VkPipelineLayout        Layout{VK_NULL_HANDLE};
+            VkPipeline              Optimized{VK_NULL_HANDLE};
+        };
+
+        struct RetiredPipeline
+        {
+            VkPipeline    Handle{VK_NULL_HANDLE};
+            std::uint32_t FramesLeft{0};
+        };
+
+        std::mutex                                          m_Mutex{};
+        std::unordered_map<std::uint64_t, VkPipelineLayout> m_Layouts{};
+        std::unordered_map<std::uint64_t, VkPipeline>       m_VertexInputLibraries{};
+        std::unordered_map<std::uint64_t, VkPipeline>       m_PreRasterLibraries{};
+        std::unordered_map<std::uint64_t, VkPipeline>       m_FragmentLibraries{};
+        std::unordered_map<std::uint64_t, VkPipeline>       m_OutputLibraries{};
+        std::vector<PendingPipeline>                        m_Pending{};
+        std::vector<RetiredPipeline>                        m_Retired{};
+        std::shared_ptr<Device>                             m_DeviceModule{};
+        std::shared_ptr<ThreadPool>                         m_ThreadPool{};
+
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT m_LibraryFeatures{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT,
+                                                                             .graphicsPipelineLibrary = VK_TRUE};
+
+    public:
+        PipelineLibrary() = delete;
+        explicit PipelineLibrary(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<ThreadPool>& ThreadPoolModule);
+
+        ~PipelineLibrary() override
+        {
+            PipelineLibrary::ClearResources();
+        }
+
+        [[nodiscard]] ExtensionMap GetDeviceExtensions() const noexcept override
+        {
+            return {{"", {VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME}}};
+        }
+
+        [[nodiscard]] const void* GetDeviceFeatureChain() const noexcept override;
+
+        [[nodiscard]] bool IsSupported() const noexcept;
+
+        [[nodiscard]] std::shared_ptr<Pipeline> CreateGraphicsPipeline(const Pipeline::CreationArguments& Arguments);
+
+        void Update();
+
+        [[nodiscard]] std::size_t GetLibraryCount();
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
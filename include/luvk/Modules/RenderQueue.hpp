@@ -0,0 +1,102 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class CommandRecorder;
+    class Mesh;
+
+    class LUVK_API RenderQueue : public IRenderModule,
+                                 public IFrameModule
+    {
+    public:
+        enum class Pass : std::uint8_t
+        {
+            Opaque,
+            Transparent
+        };
+
+        struct Packet
+        {
+            std::uint64_t Key{0};
+            const Mesh*   Object{nullptr};
+        };
+
+    protected:
+        std::uint32_t       m_FrameIndex{0};
+        std::vector<Packet> m_Packets{};
+        std::vector<Packet> m_Scratch{};
+
+    public:
+        constexpr RenderQueue() = default;
+
+        ~RenderQueue() override
+        {
+            RenderQueue::ClearResources();
+        }
+
+        [[nodiscard]] static std::uint16_t CompactId(const void* const Pointer) noexcept
+        {
+            const auto Value = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(Pointer));
+            return static_cast<std::uint16_t>((Value * 0x9E3779B97F4A7C15ULL) >> 48U);
+        }
+
+        [[nodiscard]] static constexpr std::uint16_t QuantizeDepth(const float Depth) noexcept
+        {
+            return static_cast<std::uint16_t>(std::bit_cast<std::uint32_t>(Depth > 0.F ? Depth : 0.F) >> 16U);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t MakeOpaqueKey(const std::uint16_t Pipeline,
+                                                                   const std::uint16_t Material,
+                                                                   const std::uint16_t Geometry,
+                                                                   const float         Depth) noexcept
+        {
+            return static_cast<std::uint64_t>(Pass::Opaque) << 62U |
+                   static_cast<std::uint64_t>(Pipeline & 0x3FFFU) << 48U |
+                   static_cast<std::uint64_t>(Material) << 32U |
+                   static_cast<std::uint64_t>(Geometry) << 16U |
+                   QuantizeDepth(Depth);
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t MakeTransparentKey(const std::uint16_t Pipeline,
+                                                                        const std::uint16_t Material,
+                                                                        const std::uint16_t Geometry,
+                                                                        const float         Depth) noexcept
+        {
+            return static_cast<std::uint64_t>(Pass::Transparent) << 62U |
+                   static_cast<std::uint64_t>(static_cast<std::uint16_t>(~QuantizeDepth(Depth))) << 46U |
+                   static_cast<std::uint64_t>(Pipeline & 0x3FFFU) << 32U |
+                   static_cast<std::uint64_t>(Material) << 16U |
+                   Geometry;
+        }
+
+        void Reserve(std::size_t Count);
+        void Submit(std::uint64_t Key, const Mesh& Object);
+        void Sort();
+        void Flush(CommandRecorder& Recorder);
+        void Clear() noexcept;
+
+        void BeginFrame(const std::uint32_t FrameIndex) override
+        {
+            m_FrameIndex = FrameIndex;
+        }
+
+        [[nodiscard]] constexpr std::span<const Packet> GetPackets() const noexcept
+        {
+            return m_Packets;
+        }
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
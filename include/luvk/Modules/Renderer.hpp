@@ -6,6 +6,7 @@
 
 #include <memory>
 #include "luvk/Interfaces/IEventModule.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
 #include "luvk/Interfaces/IRenderModule.hpp"
 #include "luvk/Modules/Synchronization.hpp"
 #include "luvk/Resources/Extensions.hpp"
@@ -59,11 +60,12 @@ namespace luvk
                               public IEventModule
     {
     protected:
-        bool                      m_Paused{false};
-        VkInstance                m_Instance{VK_NULL_HANDLE};
-        InstanceExtensions        m_Extensions{};
-        InstanceCreationArguments m_InstanceCreationArguments{};
-        RenderModules             m_Modules{};
+        bool                                       m_Paused{false};
+        VkInstance                                 m_Instance{VK_NULL_HANDLE};
+        InstanceExtensions                         m_Extensions{};
+        InstanceCreationArguments                  m_InstanceCreationArguments{};
+        RenderModules                              m_Modules{};
+        std::vector<std::shared_ptr<IFrameModule>> m_FrameModules{};
 
     public:
         constexpr Renderer() = default;
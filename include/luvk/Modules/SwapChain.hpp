@@ -21,6 +21,7 @@ namespace luvk
     struct SwapChainCreationArguments
     {
         bool                          Clip{true};
+        bool                          KeepDepth{false};
         VkSwapchainCreateFlagsKHR     Flags{};
         VkPresentModeKHR              PresentMode{VK_PRESENT_MODE_FIFO_KHR};
         VkSurfaceTransformFlagBitsKHR TransformFlags{VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR};
@@ -111,6 +112,11 @@ namespace luvk
             return m_DepthFormat;
         }
 
+        [[nodiscard]] constexpr bool KeepsDepth() const noexcept
+        {
+            return m_Arguments.KeepDepth;
+        }
+
         [[nodiscard]] constexpr VkRenderPass GetRenderPass() const noexcept
         {
             return m_RenderPass;
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <latch>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -35,10 +38,73 @@ namespace luvk
         void Submit(std::function<void()> Task);
         void WaitIdle();
 
+        [[nodiscard]] std::size_t GetThreadCount() const noexcept
+        {
+            return std::size(m_Threads);
+        }
+
     protected:
         void ClearResources() override;
 
     private:
         void Worker();
     };
+
+    [[nodiscard]] inline std::uint32_t GetParallelChunk(const ThreadPool* const Pool,
+                                                        const std::uint32_t     Count,
+                                                        const std::uint32_t     MinPerTask,
+                                                        const std::uint32_t     Alignment) noexcept
+    {
+        if (Count == 0U)
+        {
+            return Alignment;
+        }
+
+        const std::size_t Workers  = Pool ? Pool->GetThreadCount() : 0U;
+        const std::size_t MaxTasks = std::min<std::size_t>(Workers + 1U, (Count + MinPerTask - 1U) / MinPerTask);
+        const std::size_t PerTask  = (Count + MaxTasks - 1U) / MaxTasks;
+
+        return static_cast<std::uint32_t>((PerTask + Alignment - 1U) / Alignment * Alignment);
+    }
+
+    template <typename Function>
+    void ParallelFor(ThreadPool* const Pool, const std::uint32_t Count, const std::uint32_t Chunk, const Function& Task)
+    {
+        if (Count == 0U)
+        {
+            return;
+        }
+
+        const std::size_t Tasks = (Count + Chunk - 1U) / Chunk;
+
+        auto RunTask = [&](const std::size_t Index)
+        {
+            const auto Begin = static_cast<std::uint32_t>(Index * Chunk);
+            Task(Begin, std::min(Count, Begin + Chunk));
+        };
+
+        if (Pool && Tasks > 1U)
+        {
+            std::latch Done(static_cast<std::ptrdiff_t>(Tasks - 1U));
+
+            for (std::size_t Index = 1U; Index < Tasks; ++Index)
+            {
+                Pool->Submit([&RunTask, &Done, Index]
+                             {
+                                 RunTask(Index);
+                                 Done.count_down();
+                             });
+            }
+
+            RunTask(0U);
+            Done.wait();
+        }
+        else
+        {
+            for (std::size_t Index = 0U; Index < Tasks; ++Index)
+            {
+                RunTask(Index);
+            }
+        }
+    }
 } // namespace luvk
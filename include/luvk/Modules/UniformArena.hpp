@@ -0,0 +1,66 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Interfaces/IFrameModule.hpp"
+#include "luvk/Interfaces/IRenderModule.hpp"
+
+namespace luvk
+{
+    class Buffer;
+    class Device;
+    class Memory;
+
+    class LUVK_API UniformArena : public IRenderModule,
+                                  public IFrameModule
+    {
+    protected:
+        VkDeviceSize                                                 m_Capacity{0};
+        VkDeviceSize                                                 m_Alignment{1};
+        std::array<std::atomic<VkDeviceSize>, Constants::ImageCount> m_Heads{};
+        std::array<std::shared_ptr<Buffer>, Constants::ImageCount>   m_Buffers{};
+        std::shared_ptr<Device>                                      m_DeviceModule{};
+        std::shared_ptr<Memory>                                      m_MemoryModule{};
+
+    public:
+        UniformArena() = delete;
+        explicit UniformArena(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<Memory>& MemoryModule);
+
+        ~UniformArena() override
+        {
+            UniformArena::ClearResources();
+        }
+
+        void CreateArena(VkDeviceSize CapacityPerFrame);
+
+        [[nodiscard]] std::uint32_t Push(std::span<const std::byte> Data, VkDeviceSize Range, std::uint32_t FrameIndex);
+
+        void BeginFrame(std::uint32_t FrameIndex) override;
+
+        [[nodiscard]] std::shared_ptr<Buffer> GetBuffer(const std::uint32_t FrameIndex) const noexcept
+        {
+            return FrameIndex < Constants::ImageCount ? m_Buffers.at(FrameIndex) : nullptr;
+        }
+
+        [[nodiscard]] constexpr VkDeviceSize GetCapacity() const noexcept
+        {
+            return m_Capacity;
+        }
+
+        [[nodiscard]] constexpr VkDeviceSize GetAlignment() const noexcept
+        {
+            return m_Alignment;
+        }
+
+    protected:
+        void ClearResources() override;
+    };
+} // namespace luvk
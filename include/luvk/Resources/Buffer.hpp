@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <span>
 #include <string>
@@ -16,11 +17,21 @@ namespace luvk
 
     class LUVK_API Buffer
     {
+    public:
+        enum class UploadPath : std::uint8_t
+        {
+            Mapped,
+            DeviceLocalMapped,
+            Staged
+        };
+
     protected:
         VkBuffer                m_Buffer{VK_NULL_HANDLE};
         VmaAllocation           m_Allocation{};
         void*                   m_Map{nullptr};
         VkDeviceSize            m_Size{0};
+        VkMemoryPropertyFlags   m_MemoryProperties{0};
+        VkDeviceAddress         m_DeviceAddress{0};
         std::shared_ptr<Device> m_DeviceModule{};
         std::shared_ptr<Memory> m_MemoryModule{};
 
@@ -36,18 +47,43 @@ namespace luvk
             VkBufferUsageFlags Usage{};
             VmaMemoryUsage     MemoryUsage{VMA_MEMORY_USAGE_AUTO};
             float              Priority{1.F};
+            bool               PreferDirectWrites{false};
             std::string        Name{};
         };
 
         void CreateBuffer(const CreationArguments& Arguments);
         void RecreateBuffer(const CreationArguments& Arguments);
-        void Upload(std::span<const std::byte> Data) const;
+        void Upload(std::span<const std::byte> Data, VkDeviceSize Offset = 0) const;
+        void Upload(const std::shared_ptr<Buffer>& Staging, VkDeviceSize Offset = 0) const;
+        void UploadStaged(std::span<const std::byte> Data, VkDeviceSize Offset = 0) const;
+        void Download(std::span<std::byte> Data, VkDeviceSize Offset = 0) const;
+        void Flush(VkDeviceSize Offset = 0, VkDeviceSize Size = VK_WHOLE_SIZE) const;
+
+        [[nodiscard]] std::span<std::byte> GetMappedData() const noexcept
+        {
+            return m_Map ? std::span(static_cast<std::byte*>(m_Map), static_cast<std::size_t>(m_Size)) : std::span<std::byte>{};
+        }
+
+        [[nodiscard]] constexpr UploadPath GetUploadPath() const noexcept
+        {
+            if (!(m_MemoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+            {
+                return UploadPath::Staged;
+            }
+
+            return m_MemoryProperties & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT ? UploadPath::DeviceLocalMapped : UploadPath::Mapped;
+        }
 
         [[nodiscard]] constexpr VkBuffer GetHandle() const noexcept
         {
             return m_Buffer;
         }
 
+        [[nodiscard]] constexpr VkDeviceAddress GetDeviceAddress() const noexcept
+        {
+            return m_DeviceAddress;
+        }
+
         [[nodiscard]] constexpr VkDeviceSize GetSize() const noexcept
         {
             return m_Size;
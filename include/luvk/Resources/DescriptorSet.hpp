@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <span>
+#include <vector>
 #include <volk.h>
 
 namespace luvk
@@ -16,13 +18,38 @@ namespace luvk
 
     class LUVK_API DescriptorSet
     {
+    public:
+        union DescriptorData
+        {
+            VkDescriptorBufferInfo Buffer;
+            VkDescriptorImageInfo  Image;
+        };
+
     protected:
-        bool                            m_OwnsLayout{false};
-        VkDescriptorSetLayout           m_Layout{VK_NULL_HANDLE};
-        VkDescriptorSet                 m_Set{VK_NULL_HANDLE};
-        std::shared_ptr<Device>         m_DeviceModule{};
-        std::shared_ptr<DescriptorPool> m_PoolModule{};
-        std::shared_ptr<Memory>         m_MemoryModule{};
+        enum SlotState : std::uint8_t
+        {
+            SlotWritten = 1U << 0U,
+            SlotDirty   = 1U << 1U
+        };
+
+        bool                                      m_OwnsLayout{false};
+        bool                                      m_PushDescriptor{false};
+        VkDescriptorSetLayout                     m_Layout{VK_NULL_HANDLE};
+        VkDescriptorSet                           m_Set{VK_NULL_HANDLE};
+        VkDescriptorPool                          m_Pool{VK_NULL_HANDLE};
+        VkDescriptorUpdateTemplate                m_Template{VK_NULL_HANDLE};
+        VkDescriptorUpdateTemplate                m_PushTemplate{VK_NULL_HANDLE};
+        VkPipelineLayout                          m_PushTemplateLayout{VK_NULL_HANDLE};
+        VkPipelineBindPoint                       m_PushTemplateBindPoint{VK_PIPELINE_BIND_POINT_GRAPHICS};
+        std::uint32_t                             m_PushTemplateSet{0};
+        std::vector<VkDescriptorSetLayoutBinding> m_Bindings{};
+        std::vector<std::uint32_t>                m_FirstSlots{};
+        std::vector<DescriptorData>               m_Data{};
+        std::vector<std::uint8_t>                 m_SlotStates{};
+        std::vector<std::uint32_t>                m_DirtySlots{};
+        std::shared_ptr<Device>                   m_DeviceModule{};
+        std::shared_ptr<DescriptorPool>           m_PoolModule{};
+        std::shared_ptr<Memory>                   m_MemoryModule{};
 
     public:
         DescriptorSet() = delete;
@@ -35,21 +62,41 @@ namespace luvk
         struct LayoutInfo
         {
             std::span<const VkDescriptorSetLayoutBinding> Bindings{};
+            bool                                          PushDescriptor{false};
         };
 
         void CreateLayout(const LayoutInfo& Info);
         void UseLayout(VkDescriptorSetLayout Layout);
+        void UseLayout(VkDescriptorSetLayout Layout, std::span<const VkDescriptorSetLayoutBinding> Bindings);
         void Allocate();
+        void AllocateTransient(std::uint32_t FrameIndex);
 
         void UpdateBuffer(VkBuffer         Buffer,
                           VkDeviceSize     Size,
                           std::uint32_t    Binding,
-                          VkDescriptorType Type) const;
+                          VkDescriptorType Type,
+                          VkDeviceSize     Offset       = 0,
+                          std::uint32_t    ArrayElement = 0);
 
         void UpdateImage(VkImageView      View,
                          VkSampler        Sampler,
                          std::uint32_t    Binding,
-                         VkDescriptorType Type) const;
+                         VkDescriptorType Type,
+                         VkImageLayout    Layout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                         std::uint32_t    ArrayElement = 0);
+
+        void Flush();
+        void Push(VkCommandBuffer CommandBuffer, VkPipelineBindPoint BindPoint, VkPipelineLayout PipelineLayout, std::uint32_t SetIndex = 0);
+
+        [[nodiscard]] constexpr bool HasPendingWrites() const noexcept
+        {
+            return !std::empty(m_DirtySlots);
+        }
+
+        [[nodiscard]] constexpr bool IsPushDescriptor() const noexcept
+        {
+            return m_PushDescriptor;
+        }
 
         [[nodiscard]] constexpr VkDescriptorSetLayout GetLayout() const noexcept
         {
@@ -60,5 +107,24 @@ namespace luvk
         {
             return m_Set;
         }
+
+        [[nodiscard]] constexpr std::span<const VkDescriptorSetLayoutBinding> GetBindings() const noexcept
+        {
+            return m_Bindings;
+        }
+
+    protected:
+        [[nodiscard]] std::uint32_t FindSlot(std::uint32_t Binding, VkDescriptorType Type, std::uint32_t ArrayElement);
+
+        void StoreSlot(std::uint32_t Slot, const DescriptorData& Data, bool Equal);
+        void ResetSlots(std::span<const VkDescriptorSetLayoutBinding> Bindings);
+        void InvalidateSlots();
+        void CreateUpdateTemplate();
+        void DestroyUpdateTemplate();
+        void CreatePushTemplate(VkPipelineBindPoint BindPoint, VkPipelineLayout PipelineLayout, std::uint32_t SetIndex);
+
+        [[nodiscard]] bool                              SupportsUpdateTemplates() const noexcept;
+        [[nodiscard]] bool                              AreAllSlotsWritten() const noexcept;
+        [[nodiscard]] std::vector<VkWriteDescriptorSet> BuildWrites(std::span<const std::uint32_t> Slots) const;
     };
 } // namespace luvk
@@ -54,6 +54,20 @@ namespace luvk
                                        });
         }
 
+        [[nodiscard]] constexpr bool IsExtensionEnabled(std::string_view ExtensionName) const noexcept
+        {
+            return std::ranges::any_of(m_Layers,
+                                       [&ExtensionName](const Layer& Iterator)
+                                       {
+                                           return Iterator.Enabled &&
+                                                  std::ranges::any_of(Iterator.Extensions,
+                                                                      [&ExtensionName](const std::pair<std::string, bool>& ExtIterator)
+                                                                      {
+                                                                          return ExtIterator.second && std::ranges::equal(ExtIterator.first, ExtensionName);
+                                                                      });
+                                       });
+        }
+
         [[nodiscard]] const std::vector<Layer>& GetLayers() const noexcept
         {
             return m_Layers;
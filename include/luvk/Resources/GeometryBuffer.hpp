@@ -0,0 +1,86 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <volk.h>
+
+namespace luvk
+{
+    class Buffer;
+    class Device;
+    class Memory;
+
+    class LUVK_API GeometryBuffer
+    {
+    public:
+        struct Range
+        {
+            std::uint32_t FirstIndex{0};
+            std::uint32_t IndexCount{0};
+            std::int32_t  VertexOffset{0};
+            std::uint32_t VertexCount{0};
+        };
+
+    protected:
+        VkDeviceSize            m_VertexStride{0};
+        std::uint32_t           m_MaxVertices{0};
+        std::uint32_t           m_MaxIndices{0};
+        std::uint32_t           m_VertexCount{0};
+        std::uint32_t           m_IndexCount{0};
+        std::shared_ptr<Buffer> m_VertexBuffer{};
+        std::shared_ptr<Buffer> m_IndexBuffer{};
+        std::shared_ptr<Device> m_DeviceModule{};
+        std::shared_ptr<Memory> m_MemoryModule{};
+
+    public:
+        GeometryBuffer() = delete;
+        explicit GeometryBuffer(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<Memory>& MemoryModule);
+
+        ~GeometryBuffer() = default;
+
+        struct CreationArguments
+        {
+            VkDeviceSize  VertexStride{0};
+            std::uint32_t MaxVertices{0};
+            std::uint32_t MaxIndices{0};
+            std::string   Name{};
+        };
+
+        void CreateGeometryBuffer(const CreationArguments& Arguments);
+
+        [[nodiscard]] Range Append(std::span<const std::byte> Vertices, std::span<const std::uint32_t> Indices);
+
+        void Reset() noexcept;
+
+        [[nodiscard]] std::shared_ptr<Buffer> GetVertexBuffer() const noexcept
+        {
+            return m_VertexBuffer;
+        }
+
+        [[nodiscard]] std::shared_ptr<Buffer> GetIndexBuffer() const noexcept
+        {
+            return m_IndexBuffer;
+        }
+
+        [[nodiscard]] constexpr VkDeviceSize GetVertexStride() const noexcept
+        {
+            return m_VertexStride;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetVertexCount() const noexcept
+        {
+            return m_VertexCount;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetIndexCount() const noexcept
+        {
+            return m_IndexCount;
+        }
+    };
+} // namespace luvk
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <span>
+#include <vector>
 #include <vk_mem_alloc.h>
 
 namespace luvk
@@ -18,13 +19,15 @@ namespace luvk
     class LUVK_API Image
     {
     protected:
-        std::uint32_t           m_Width{0};
-        std::uint32_t           m_Height{0};
-        VkImage                 m_Image{VK_NULL_HANDLE};
-        VkImageView             m_View{VK_NULL_HANDLE};
-        VmaAllocation           m_Allocation{};
-        std::shared_ptr<Memory> m_MemoryModule{};
-        std::shared_ptr<Device> m_DeviceModule{};
+        std::uint32_t            m_Width{0};
+        std::uint32_t            m_Height{0};
+        std::uint32_t            m_MipLevels{1};
+        VkImage                  m_Image{VK_NULL_HANDLE};
+        VkImageView              m_View{VK_NULL_HANDLE};
+        std::vector<VkImageView> m_MipViews{};
+        VmaAllocation            m_Allocation{};
+        std::shared_ptr<Memory>  m_MemoryModule{};
+        std::shared_ptr<Device>  m_DeviceModule{};
 
     public:
         Image() = delete;
@@ -40,6 +43,8 @@ namespace luvk
             VkImageAspectFlags Aspect{VK_IMAGE_ASPECT_COLOR_BIT};
             VmaMemoryUsage     MemoryUsage{VMA_MEMORY_USAGE_AUTO};
             float              Priority{1.F};
+            std::uint32_t      MipLevels{1};
+            bool               CreateMipViews{false};
         };
 
         void CreateImage(const CreationArguments& Arguments);
@@ -56,5 +61,20 @@ namespace luvk
         {
             return m_View;
         }
+
+        [[nodiscard]] VkImageView GetMipView(const std::uint32_t Level) const
+        {
+            return m_MipViews.at(Level);
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetMipLevels() const noexcept
+        {
+            return m_MipLevels;
+        }
+
+        [[nodiscard]] constexpr VkExtent2D GetExtent() const noexcept
+        {
+            return {m_Width, m_Height};
+        }
     };
 } // namespace luvk
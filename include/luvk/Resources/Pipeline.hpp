@@ -13,6 +13,7 @@ namespace luvk
 {
     class Device;
     class PipelineCache;
+    class ShaderModuleCache;
 
     class LUVK_API Pipeline
     {
@@ -28,7 +29,9 @@ namespace luvk
         Type                             m_Type{Type::Graphics};
         VkPipelineLayout                 m_PipelineLayout{VK_NULL_HANDLE};
         VkPipeline                       m_Pipeline{VK_NULL_HANDLE};
+        VkShaderStageFlags               m_PushConstantStages{0};
         std::vector<VkPushConstantRange> m_PushConstants{};
+        bool                             m_OwnsLayout{true};
         std::shared_ptr<Device>          m_DeviceModule{};
 
     public:
@@ -53,8 +56,15 @@ namespace luvk
             VkCullModeFlags                                    CullMode{VK_CULL_MODE_BACK_BIT};
             VkFrontFace                                        FrontFace{VK_FRONT_FACE_COUNTER_CLOCKWISE};
             bool                                               EnableDepthOp{true};
+            bool                                               EnableDepthWrite{true};
+            VkCompareOp                                        DepthCompareOp{VK_COMPARE_OP_LESS};
+            VkColorComponentFlags                              ColorWriteMask{VK_COLOR_COMPONENT_R_BIT |
+                                                                              VK_COLOR_COMPONENT_G_BIT |
+                                                                              VK_COLOR_COMPONENT_B_BIT |
+                                                                              VK_COLOR_COMPONENT_A_BIT};
             VkPipelineCreateFlags                              Flags{0};
             PipelineCache*                                     Cache{};
+            ShaderModuleCache*                                 Modules{};
         };
 
         struct ComputeCreationArguments
@@ -64,6 +74,7 @@ namespace luvk
             std::span<const VkPushConstantRange>   PushConstants{};
             VkPipelineCreateFlags                  Flags{0};
             PipelineCache*                         Cache{};
+            ShaderModuleCache*                     Modules{};
         };
 
         struct MeshCreationArguments
@@ -82,6 +93,7 @@ namespace luvk
             bool                                   EnableDepthOp{true};
             VkPipelineCreateFlags                  Flags{0};
             PipelineCache*                         Cache{};
+            ShaderModuleCache*                     Modules{};
         };
 
         void CreateGraphicsPipeline(const CreationArguments& Arguments);
@@ -91,6 +103,9 @@ namespace luvk
         void CreateMeshPipeline(const MeshCreationArguments& Arguments);
         void RecreateMeshPipeline(const MeshCreationArguments& Arguments);
 
+        void               AssignLinkedPipeline(VkPipeline LinkedPipeline, VkPipelineLayout SharedLayout, std::span<const VkPushConstantRange> PushConstants);
+        [[nodiscard]] bool CompareExchangePipeline(VkPipeline Expected, VkPipelineLayout ExpectedLayout, VkPipeline NewPipeline) noexcept;
+
         [[nodiscard]] constexpr VkPipeline GetPipeline() const noexcept
         {
             return m_Pipeline;
@@ -106,6 +121,11 @@ namespace luvk
             return m_PushConstants;
         }
 
+        [[nodiscard]] constexpr VkShaderStageFlags GetPushConstantStages() const noexcept
+        {
+            return m_PushConstantStages;
+        }
+
         [[nodiscard]] constexpr Type GetType() const noexcept
         {
             return m_Type;
@@ -124,5 +144,6 @@ namespace luvk
 
     protected:
         void Clear();
+        void StorePushConstants(std::span<const VkPushConstantRange> Ranges);
     };
 } // namespace luvk
@@ -0,0 +1,43 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <span>
+#include <vector>
+#include "luvk/Resources/Pipeline.hpp"
+
+namespace luvk
+{
+    class Device;
+    class ShaderModuleCache;
+    class ThreadPool;
+
+    class LUVK_API PipelineBatch
+    {
+    protected:
+        std::shared_ptr<ShaderModuleCache> m_Modules{};
+        std::shared_ptr<ThreadPool>        m_ThreadPool{};
+        std::shared_ptr<Device>            m_DeviceModule{};
+
+    public:
+        PipelineBatch() = delete;
+        explicit PipelineBatch(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<ThreadPool>& ThreadPoolModule);
+
+        ~PipelineBatch() = default;
+
+        [[nodiscard]] std::vector<std::future<std::shared_ptr<Pipeline>>> CreateGraphicsPipelines(std::span<const Pipeline::CreationArguments> Arguments) const;
+        [[nodiscard]] std::vector<std::future<std::shared_ptr<Pipeline>>> CreateComputePipelines(std::span<const Pipeline::ComputeCreationArguments> Arguments) const;
+        [[nodiscard]] std::vector<std::future<std::shared_ptr<Pipeline>>> CreateMeshPipelines(std::span<const Pipeline::MeshCreationArguments> Arguments) const;
+
+        void ReleaseShaderModules() const;
+
+        [[nodiscard]] constexpr const std::shared_ptr<ShaderModuleCache>& GetShaderModuleCache() const noexcept
+        {
+            return m_Modules;
+        }
+    };
+} // namespace luvk
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <volk.h>
 
 namespace luvk
@@ -13,12 +18,27 @@ namespace luvk
 
     class LUVK_API PipelineCache
     {
+    public:
+        struct Statistics
+        {
+            std::uint64_t Hits{0};
+            std::uint64_t Misses{0};
+            std::uint64_t CreationTime{0};
+        };
+
     protected:
-        VkPipelineCache         m_PreRaster{VK_NULL_HANDLE};
-        VkPipelineCache         m_Fragment{VK_NULL_HANDLE};
-        VkPipelineCache         m_Output{VK_NULL_HANDLE};
-        VkPipelineCache         m_Composite{VK_NULL_HANDLE};
-        std::shared_ptr<Device> m_DeviceModule{};
+        VkPipelineCache              m_PreRaster{VK_NULL_HANDLE};
+        VkPipelineCache              m_Fragment{VK_NULL_HANDLE};
+        VkPipelineCache              m_Output{VK_NULL_HANDLE};
+        VkPipelineCache              m_Composite{VK_NULL_HANDLE};
+        std::filesystem::path        m_Path{};
+        bool                         m_Loaded{false};
+        std::mutex                   m_WorkerMutex{};
+        std::vector<VkPipelineCache> m_WorkerCaches{};
+        std::atomic<std::uint64_t>   m_Hits{0};
+        std::atomic<std::uint64_t>   m_Misses{0};
+        std::atomic<std::uint64_t>   m_CreationTime{0};
+        std::shared_ptr<Device>      m_DeviceModule{};
 
     public:
         PipelineCache() = delete;
@@ -26,7 +46,20 @@ namespace luvk
 
         ~PipelineCache();
 
-        void Create();
+        void Create(const std::filesystem::path& Path = {});
+        bool Save();
+        bool Save(const std::filesystem::path& Path);
+
+        [[nodiscard]] VkPipelineCache CreateWorkerCache();
+        void                          MergeWorkerCaches();
+
+        void                     RecordFeedback(const VkPipelineCreationFeedback& Feedback) noexcept;
+        [[nodiscard]] Statistics GetStatistics() const noexcept;
+
+        [[nodiscard]] constexpr bool IsLoadedFromDisk() const noexcept
+        {
+            return m_Loaded;
+        }
 
         [[nodiscard]] constexpr VkPipelineCache GetPreRasterCache() const noexcept
         {
@@ -0,0 +1,72 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "luvk/Resources/Pipeline.hpp"
+
+namespace luvk
+{
+    class Device;
+
+    class LUVK_API PipelineRegistry
+    {
+    protected:
+        struct Entry
+        {
+            std::vector<std::byte>                        Material{};
+            std::weak_ptr<Pipeline>                       Resolved{};
+            std::shared_future<std::shared_ptr<Pipeline>> Pending{};
+        };
+
+        std::mutex                                            m_Mutex{};
+        std::unordered_map<std::uint64_t, std::vector<Entry>> m_Entries{};
+        std::atomic<std::uint64_t>                            m_Compiles{0};
+        std::atomic<std::uint64_t>                            m_Reuses{0};
+        std::shared_ptr<Device>                               m_DeviceModule{};
+
+    public:
+        PipelineRegistry() = delete;
+        explicit PipelineRegistry(const std::shared_ptr<Device>& DeviceModule);
+
+        ~PipelineRegistry() = default;
+
+        [[nodiscard]] std::shared_ptr<Pipeline> Acquire(const Pipeline::CreationArguments& Arguments);
+        [[nodiscard]] std::shared_ptr<Pipeline> Acquire(const Pipeline::ComputeCreationArguments& Arguments);
+        [[nodiscard]] std::shared_ptr<Pipeline> Acquire(const Pipeline::MeshCreationArguments& Arguments);
+
+        [[nodiscard]] static std::uint64_t ComputeKey(const Pipeline::CreationArguments& Arguments);
+        [[nodiscard]] static std::uint64_t ComputeKey(const Pipeline::ComputeCreationArguments& Arguments);
+        [[nodiscard]] static std::uint64_t ComputeKey(const Pipeline::MeshCreationArguments& Arguments);
+
+        [[nodiscard]] static std::vector<std::byte> BuildKeyMaterial(const Pipeline::CreationArguments& Arguments);
+        [[nodiscard]] static std::vector<std::byte> BuildKeyMaterial(const Pipeline::ComputeCreationArguments& Arguments);
+        [[nodiscard]] static std::vector<std::byte> BuildKeyMaterial(const Pipeline::MeshCreationArguments& Arguments);
+
+        void                      Prune();
+        [[nodiscard]] std::size_t GetPipelineCount();
+
+        [[nodiscard]] std::uint64_t GetCompileCount() const noexcept
+        {
+            return m_Compiles.load();
+        }
+
+        [[nodiscard]] std::uint64_t GetReuseCount() const noexcept
+        {
+            return m_Reuses.load();
+        }
+
+    protected:
+        [[nodiscard]] std::shared_ptr<Pipeline> FindOrCreate(std::vector<std::byte>&& Material, const std::function<void(Pipeline&)>& Create);
+    };
+} // namespace luvk
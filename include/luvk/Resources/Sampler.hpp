@@ -27,6 +27,7 @@ namespace luvk
         {
             VkFilter             Filter{VK_FILTER_LINEAR};
             VkSamplerAddressMode AddressMode{VK_SAMPLER_ADDRESS_MODE_REPEAT};
+            VkSamplerMipmapMode  MipmapMode{VK_SAMPLER_MIPMAP_MODE_LINEAR};
         };
 
         void CreateSampler(const CreationArguments& Arguments);
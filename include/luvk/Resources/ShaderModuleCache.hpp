@@ -0,0 +1,43 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include <volk.h>
+
+namespace luvk
+{
+    class Device;
+
+    class LUVK_API ShaderModuleCache
+    {
+    protected:
+        struct Entry
+        {
+            std::vector<std::uint32_t> Code{};
+            VkShaderModule             Module{VK_NULL_HANDLE};
+        };
+
+        std::mutex                                            m_Mutex{};
+        std::unordered_map<std::uint64_t, std::vector<Entry>> m_Entries{};
+        std::shared_ptr<Device>                               m_DeviceModule{};
+
+    public:
+        ShaderModuleCache() = delete;
+        explicit ShaderModuleCache(const std::shared_ptr<Device>& DeviceModule);
+
+        ~ShaderModuleCache();
+
+        [[nodiscard]] VkShaderModule Acquire(std::span<const std::uint32_t> Code);
+        [[nodiscard]] std::size_t    GetModuleCount();
+
+        void Clear();
+    };
+} // namespace luvk
@@ -0,0 +1,174 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view DepthPyramid = R"(
+struct PyramidParameters
+{
+    uint2  SourceSize;
+    uint2  PyramidSize;
+    float2 SourceScale;
+    uint   MipCount;
+    uint   GroupCount;
+    uint   ReverseDepth;
+};
+
+[[vk::binding(0, 0)]] Texture2D<float>                                                DepthSource;
+[[vk::binding(1, 0)]] globallycoherent RWStructuredBuffer<uint>                      Counter;
+[[vk::binding(2, 0)]] [[vk::image_format("r32f")]] globallycoherent RWTexture2D<float> Mips[13];
+
+[[vk::push_constant]] ConstantBuffer<PyramidParameters> Parameters;
+
+groupshared float Tile[16][16];
+groupshared uint  IsLastGroup;
+
+float Reduce(float A, float B)
+{
+    return Parameters.ReverseDepth != 0 ? min(A, B) : max(A, B);
+}
+
+float Reduce4(float A, float B, float C, float D)
+{
+    return Reduce(Reduce(A, B), Reduce(C, D));
+}
+
+uint2 GetMipSize(uint Level)
+{
+    return max(Parameters.PyramidSize >> Level, uint2(1));
+}
+
+float LoadSource(uint2 Texel)
+{
+    const int2 Limit = int2(Parameters.SourceSize) - 1;
+    const int2 First = min(int2(floor(float2(Texel) * Parameters.SourceScale)), Limit);
+    const int2 Last  = min(int2(ceil(float2(Texel + 1) * Parameters.SourceScale)) - 1, Limit);
+
+    float Value = DepthSource.Load(int3(First, 0));
+
+    for (int Y = First.y; Y <= Last.y; ++Y)
+    {
+        for (int X = First.x; X <= Last.x; ++X)
+        {
+            Value = Reduce(Value, DepthSource.Load(int3(X, Y, 0)));
+        }
+    }
+
+    return Value;
+}
+
+float ReduceTile(uint2 Local)
+{
+    const uint2 Source = Local * 2;
+    return Reduce4(Tile[Source.y][Source.x], Tile[Source.y][Source.x + 1], Tile[Source.y + 1][Source.x], Tile[Source.y + 1][Source.x + 1]);
+}
+
+float ReduceMip(RWTexture2D<float> Source, uint2 Texel, uint2 Limit)
+{
+    const uint2 First = Texel * 2;
+    return Reduce4(Source[min(First, Limit)],
+                   Source[min(First + uint2(1, 0), Limit)],
+                   Source[min(First + uint2(0, 1), Limit)],
+                   Source[min(First + uint2(1, 1), Limit)]);
+}
+
+void StoreMip(RWTexture2D<float> Target, uint Level, uint2 Texel, float Value)
+{
+    if (Level < Parameters.MipCount && all(Texel < GetMipSize(Level)))
+    {
+        Target[Texel] = Value;
+    }
+}
+
+[shader("compute")]
+[numthreads(16, 16, 1)]
+void main(uint3 GroupId : SV_GroupID, uint3 LocalId : SV_GroupThreadID, uint LocalIndex : SV_GroupIndex)
+{
+    const uint2 Base  = GroupId.xy * 32 + LocalId.xy * 2;
+    const uint2 Limit = GetMipSize(0) - 1;
+
+    float Values[4];
+
+    [ForceUnroll]
+    for (uint Quad = 0; Quad < 4; ++Quad)
+    {
+        const uint2 Texel = Base + uint2(Quad & 1, Quad >> 1);
+
+        Values[Quad] = LoadSource(min(Texel, Limit));
+        StoreMip(Mips[0], 0, Texel, Values[Quad]);
+    }
+
+    float Value = Reduce4(Values[0], Values[1], Values[2], Values[3]);
+    StoreMip(Mips[1], 1, GroupId.xy * 16 + LocalId.xy, Value);
+
+    Tile[LocalId.y][LocalId.x] = Value;
+    GroupMemoryBarrierWithGroupSync();
+
+    [ForceUnroll]
+    for (uint Level = 2; Level < 6; ++Level)
+    {
+        const uint Extent = 32 >> Level;
+        const bool Active = all(LocalId.xy < Extent);
+
+        if (Active)
+        {
+            Value = ReduceTile(LocalId.xy);
+            StoreMip(Mips[Level], Level, GroupId.xy * Extent + LocalId.xy, Value);
+        }
+
+        GroupMemoryBarrierWithGroupSync();
+
+        if (Active)
+        {
+            Tile[LocalId.y][LocalId.x] = Value;
+        }
+
+        GroupMemoryBarrierWithGroupSync();
+    }
+
+    if (Parameters.MipCount <= 6)
+    {
+        return;
+    }
+
+    DeviceMemoryBarrierWithGroupSync();
+
+    if (LocalIndex == 0)
+    {
+        uint Previous;
+        InterlockedAdd(Counter[0], 1, Previous);
+        IsLastGroup = Previous + 1 == Parameters.GroupCount ? 1 : 0;
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    if (IsLastGroup == 0)
+    {
+        return;
+    }
+
+    [ForceUnroll]
+    for (uint Level = 6; Level < 13; ++Level)
+    {
+        if (Level < Parameters.MipCount)
+        {
+            const uint2 Size        = GetMipSize(Level);
+            const uint2 SourceLimit = GetMipSize(Level - 1) - 1;
+
+            for (uint Index = LocalIndex; Index < Size.x * Size.y; Index += 256)
+            {
+                const uint2 Texel = uint2(Index % Size.x, Index / Size.x);
+                Mips[Level][Texel] = ReduceMip(Mips[Level - 1], Texel, SourceLimit);
+            }
+        }
+
+        DeviceMemoryBarrierWithGroupSync();
+    }
+}
+)";
+} // namespace luvk::Shaders
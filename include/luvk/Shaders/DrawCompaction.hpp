@@ -0,0 +1,88 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view DrawCompaction = R"(
+struct DrawRecord
+{
+    uint FirstIndex;
+    uint IndexCount;
+    int  VertexOffset;
+    uint InstanceIndex;
+    uint Bucket;
+    uint Visible;
+    uint Reserved0;
+    uint Reserved1;
+};
+
+struct DrawIndexedIndirectCommand
+{
+    uint IndexCount;
+    uint InstanceCount;
+    uint FirstIndex;
+    int  VertexOffset;
+    uint FirstInstance;
+};
+
+struct CompactionParameters
+{
+    uint RecordCount;
+    uint FixedSlots;
+};
+
+[[vk::binding(0, 0)]] StructuredBuffer<DrawRecord>                   Records;
+[[vk::binding(1, 0)]] RWStructuredBuffer<DrawIndexedIndirectCommand> Commands;
+[[vk::binding(2, 0)]] RWStructuredBuffer<uint>                       Counts;
+[[vk::binding(3, 0)]] StructuredBuffer<uint2>                        Buckets;
+
+[[vk::push_constant]] ConstantBuffer<CompactionParameters> Parameters;
+
+[shader("compute")]
+[numthreads(64, 1, 1)]
+void main(uint3 ThreadId : SV_DispatchThreadID)
+{
+    const uint Index = ThreadId.x;
+
+    if (Index >= Parameters.RecordCount)
+    {
+        return;
+    }
+
+    const DrawRecord Record = Records[Index];
+
+    if (Record.Visible == 0 || Record.IndexCount == 0)
+    {
+        return;
+    }
+
+    const uint2 Bucket = Buckets[Record.Bucket];
+
+    uint Slot = Record.Reserved0;
+
+    if (Parameters.FixedSlots == 0)
+    {
+        InterlockedAdd(Counts[Record.Bucket], 1, Slot);
+    }
+
+    if (Slot >= Bucket.y)
+    {
+        return;
+    }
+
+    DrawIndexedIndirectCommand Command;
+    Command.IndexCount    = Record.IndexCount;
+    Command.InstanceCount = 1;
+    Command.FirstIndex    = Record.FirstIndex;
+    Command.VertexOffset  = Record.VertexOffset;
+    Command.FirstInstance = Parameters.FixedSlots == 0 ? Record.InstanceIndex : 0;
+
+    Commands[Bucket.x + Slot] = Command;
+}
+)";
+} // namespace luvk::Shaders
@@ -0,0 +1,161 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view InstanceCullingOcclusionDefine = "#define LUVK_CULLING_OCCLUSION 1\n";
+
+    constexpr std::string_view InstanceCulling = R"(
+struct CullingView
+{
+    float4   Planes[6];
+    float4x4 OcclusionViewProjection;
+};
+
+struct InstanceBounds
+{
+    float3 Center;
+    float  Radius;
+    float3 Extents;
+    uint   Shape;
+};
+
+struct CullingParameters
+{
+    uint  InstanceCount;
+    uint  InstanceStride;
+    uint  PyramidMips;
+    float PyramidWidth;
+    float PyramidHeight;
+    uint  ReverseDepth;
+};
+
+[[vk::binding(0, 0)]] ConstantBuffer<CullingView>      View;
+[[vk::binding(1, 0)]] StructuredBuffer<InstanceBounds> Bounds;
+[[vk::binding(2, 0)]] StructuredBuffer<uint>           SourceInstances;
+[[vk::binding(3, 0)]] RWStructuredBuffer<uint>         CompactedInstances;
+[[vk::binding(4, 0)]] RWStructuredBuffer<uint>         VisibleIndices;
+[[vk::binding(5, 0)]] RWStructuredBuffer<uint>         DrawCommand;
+
+#ifdef LUVK_CULLING_OCCLUSION
+[[vk::binding(6, 0)]] Sampler2D DepthPyramid;
+#endif
+
+[[vk::push_constant]] ConstantBuffer<CullingParameters> Parameters;
+
+float3 GetExtents(InstanceBounds Instance)
+{
+    return Instance.Shape == 0 ? float3(Instance.Radius) : Instance.Extents;
+}
+
+bool IsInsideFrustum(InstanceBounds Instance)
+{
+    const float3 Extents = GetExtents(Instance);
+
+    for (uint Plane = 0; Plane < 6; ++Plane)
+    {
+        const float4 Equation = View.Planes[Plane];
+        const float  Radius   = Instance.Shape == 0 ? Instance.Radius : dot(abs(Equation.xyz), Extents);
+
+        if (dot(Equation.xyz, Instance.Center) + Equation.w < -Radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#ifdef LUVK_CULLING_OCCLUSION
+bool IsUnoccluded(InstanceBounds Instance)
+{
+    const float3 Extents = GetExtents(Instance);
+
+    const bool Reverse = Parameters.ReverseDepth != 0;
+
+    float2 MinUV        = float2(1.0);
+    float2 MaxUV        = float2(0.0);
+    float  NearestDepth = Reverse ? 0.0 : 1.0;
+
+    for (uint Corner = 0; Corner < 8; ++Corner)
+    {
+        const float3 Sign = float3((Corner & 1) != 0 ? 1.0 : -1.0, (Corner & 2) != 0 ? 1.0 : -1.0, (Corner & 4) != 0 ? 1.0 : -1.0);
+        const float4 Clip = mul(View.OcclusionViewProjection, float4(Instance.Center + Sign * Extents, 1.0));
+
+        if (Clip.w <= 1e-5)
+        {
+            return true;
+        }
+
+        const float3 Ndc = Clip.xyz / Clip.w;
+        const float2 UV  = Ndc.xy * 0.5 + 0.5;
+
+        MinUV        = min(MinUV, UV);
+        MaxUV        = max(MaxUV, UV);
+        NearestDepth = Reverse ? max(NearestDepth, Ndc.z) : min(NearestDepth, Ndc.z);
+    }
+
+    MinUV = saturate(MinUV);
+    MaxUV = saturate(MaxUV);
+
+    const float2 Size  = (MaxUV - MinUV) * float2(Parameters.PyramidWidth, Parameters.PyramidHeight);
+    const float  Level = min(ceil(log2(max(max(Size.x, Size.y), 1.0))), float(Parameters.PyramidMips - 1));
+
+    const float4 Depths = float4(DepthPyramid.SampleLevel(MinUV, Level).x,
+                                 DepthPyramid.SampleLevel(float2(MaxUV.x, MinUV.y), Level).x,
+                                 DepthPyramid.SampleLevel(float2(MinUV.x, MaxUV.y), Level).x,
+                                 DepthPyramid.SampleLevel(MaxUV, Level).x);
+
+    if (Reverse)
+    {
+        return NearestDepth >= min(min(Depths.x, Depths.y), min(Depths.z, Depths.w));
+    }
+
+    return NearestDepth <= max(max(Depths.x, Depths.y), max(Depths.z, Depths.w));
+}
+#endif
+
+[shader("compute")]
+[numthreads(64, 1, 1)]
+void main(uint3 ThreadId : SV_DispatchThreadID)
+{
+    const uint Index = ThreadId.x;
+
+    if (Index >= Parameters.InstanceCount)
+    {
+        return;
+    }
+
+    const InstanceBounds Instance = Bounds[Index];
+
+    if (!IsInsideFrustum(Instance))
+    {
+        return;
+    }
+
+#ifdef LUVK_CULLING_OCCLUSION
+    if (!IsUnoccluded(Instance))
+    {
+        return;
+    }
+#endif
+
+    uint Slot;
+    InterlockedAdd(DrawCommand[1], 1, Slot);
+
+    VisibleIndices[Slot] = Index;
+
+    const uint Stride = Parameters.InstanceStride;
+
+    for (uint Word = 0; Word < Stride; ++Word)
+    {
+        CompactedInstances[Slot * Stride + Word] = SourceInstances[Index * Stride + Word];
+    }
+}
+)";
+} // namespace luvk::Shaders
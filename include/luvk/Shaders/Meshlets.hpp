@@ -0,0 +1,168 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view MeshletCommon = R"(
+#ifndef LUVK_MESHLET_SET
+#define LUVK_MESHLET_SET 1
+#endif
+
+#define LUVK_MESHLET_GROUP_SIZE 32
+#define LUVK_MESHLET_MAX_VERTICES 64
+#define LUVK_MESHLET_MAX_TRIANGLES 124
+
+struct MeshletView
+{
+    float4x4 ViewProjection;
+    float4   Planes[6];
+    float4   CameraPosition;
+};
+
+struct Meshlet
+{
+    uint   VertexOffset;
+    uint   TriangleOffset;
+    uint   VertexCount;
+    uint   TriangleCount;
+    float3 Center;
+    float  Radius;
+    float3 ConeApex;
+    float  ConeCutoff;
+    float3 ConeAxis;
+    float  Padding;
+};
+
+struct MeshletParameters
+{
+    float4x4 Model;
+    uint     MeshletCount;
+    uint     VertexStride;
+    uint     PositionOffset;
+    uint     Padding;
+};
+
+struct MeshletPayload
+{
+    uint MeshletIndices[LUVK_MESHLET_GROUP_SIZE];
+};
+
+[[vk::binding(0, LUVK_MESHLET_SET)]] ConstantBuffer<MeshletView> View;
+[[vk::binding(1, LUVK_MESHLET_SET)]] StructuredBuffer<Meshlet>   Meshlets;
+[[vk::binding(2, LUVK_MESHLET_SET)]] StructuredBuffer<uint>      MeshletVertices;
+[[vk::binding(3, LUVK_MESHLET_SET)]] StructuredBuffer<uint>      MeshletTriangles;
+[[vk::binding(4, LUVK_MESHLET_SET)]] ByteAddressBuffer           Vertices;
+
+[[vk::push_constant]] ConstantBuffer<MeshletParameters> Parameters;
+)";
+
+    constexpr std::string_view MeshletTask = R"(
+groupshared MeshletPayload Payload;
+groupshared uint           VisibleCount;
+
+bool IsMeshletVisible(Meshlet Current)
+{
+    const float3 Center = mul(Parameters.Model, float4(Current.Center, 1.0)).xyz;
+    const float  Scale  = max(length(float3(Parameters.Model[0][0], Parameters.Model[1][0], Parameters.Model[2][0])),
+                              max(length(float3(Parameters.Model[0][1], Parameters.Model[1][1], Parameters.Model[2][1])),
+                                  length(float3(Parameters.Model[0][2], Parameters.Model[1][2], Parameters.Model[2][2]))));
+    const float  Radius = Current.Radius * Scale;
+
+    for (uint Plane = 0; Plane < 6; ++Plane)
+    {
+        if (dot(View.Planes[Plane].xyz, Center) + View.Planes[Plane].w < -Radius)
+        {
+            return false;
+        }
+    }
+
+    if (Current.ConeCutoff >= 1.0)
+    {
+        return true;
+    }
+
+    const float3 Apex = mul(Parameters.Model, float4(Current.ConeApex, 1.0)).xyz;
+    const float3 Axis = normalize(mul((float3x3)Parameters.Model, Current.ConeAxis));
+
+    return dot(normalize(Apex - View.CameraPosition.xyz), Axis) < Current.ConeCutoff;
+}
+
+[shader("amplification")]
+[numthreads(LUVK_MESHLET_GROUP_SIZE, 1, 1)]
+void main(uint3 DispatchThreadId : SV_DispatchThreadID, uint GroupIndex : SV_GroupIndex)
+{
+    if (GroupIndex == 0)
+    {
+        VisibleCount = 0;
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    const uint MeshletIndex = DispatchThreadId.x;
+
+    if (MeshletIndex < Parameters.MeshletCount && IsMeshletVisible(Meshlets[MeshletIndex]))
+    {
+        uint Slot;
+        InterlockedAdd(VisibleCount, 1, Slot);
+        Payload.MeshletIndices[Slot] = MeshletIndex;
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    DispatchMesh(VisibleCount, 1, 1, Payload);
+}
+)";
+
+    constexpr std::string_view MeshletMesh = R"(
+struct MeshletVertex
+{
+    float4 Position      : SV_Position;
+    float3 WorldPosition : POSITION;
+    float3 Color         : COLOR;
+};
+
+float3 GetMeshletColor(uint MeshletIndex)
+{
+    const uint Hash = MeshletIndex * 2654435761u;
+    return float3(Hash & 255, (Hash >> 8) & 255, (Hash >> 16) & 255) / 255.0;
+}
+
+[shader("mesh")]
+[outputtopology("triangle")]
+[numthreads(LUVK_MESHLET_GROUP_SIZE, 1, 1)]
+void main(uint                     GroupIndex : SV_GroupIndex,
+          uint3                    GroupId : SV_GroupID,
+          in payload MeshletPayload Payload,
+          out vertices MeshletVertex OutputVertices[LUVK_MESHLET_MAX_VERTICES],
+          out indices uint3          OutputTriangles[LUVK_MESHLET_MAX_TRIANGLES])
+{
+    const uint    MeshletIndex = Payload.MeshletIndices[GroupId.x];
+    const Meshlet Current      = Meshlets[MeshletIndex];
+    const float3  Color        = GetMeshletColor(MeshletIndex);
+
+    SetMeshOutputCounts(Current.VertexCount, Current.TriangleCount);
+
+    for (uint Vertex = GroupIndex; Vertex < Current.VertexCount; Vertex += LUVK_MESHLET_GROUP_SIZE)
+    {
+        const uint   VertexIndex = MeshletVertices[Current.VertexOffset + Vertex];
+        const float3 Position    = Vertices.Load<float3>(VertexIndex * Parameters.VertexStride + Parameters.PositionOffset);
+        const float4 World       = mul(Parameters.Model, float4(Position, 1.0));
+
+        OutputVertices[Vertex].Position      = mul(View.ViewProjection, World);
+        OutputVertices[Vertex].WorldPosition = World.xyz;
+        OutputVertices[Vertex].Color         = Color;
+    }
+
+    for (uint Triangle = GroupIndex; Triangle < Current.TriangleCount; Triangle += LUVK_MESHLET_GROUP_SIZE)
+    {
+        const uint Packed = MeshletTriangles[Current.TriangleOffset + Triangle];
+        OutputTriangles[Triangle] = uint3(Packed & 255, (Packed >> 8) & 255, (Packed >> 16) & 255);
+    }
+}
+)";
+} // namespace luvk::Shaders
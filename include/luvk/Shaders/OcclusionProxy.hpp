@@ -0,0 +1,44 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view OcclusionProxyVertex = R"(
+struct ProxyParameters
+{
+    float4x4 ViewProjection;
+    float4   Center;
+    float4   Extents;
+};
+
+[[vk::push_constant]] ConstantBuffer<ProxyParameters> Parameters;
+
+static const uint BoxIndices[36] = {0, 2, 1, 1, 2, 3,
+                                    4, 5, 6, 5, 7, 6,
+                                    0, 1, 4, 1, 5, 4,
+                                    2, 6, 3, 3, 6, 7,
+                                    0, 4, 2, 2, 4, 6,
+                                    1, 3, 5, 3, 7, 5};
+
+[shader("vertex")]
+float4 main(uint VertexId : SV_VertexID) : SV_Position
+{
+    const uint   Corner = BoxIndices[VertexId % 36];
+    const float3 Sign   = float3((Corner & 1) != 0 ? 1.0 : -1.0, (Corner & 2) != 0 ? 1.0 : -1.0, (Corner & 4) != 0 ? 1.0 : -1.0);
+
+    return mul(Parameters.ViewProjection, float4(Parameters.Center.xyz + Sign * Parameters.Extents.xyz, 1.0));
+}
+)";
+
+    constexpr std::string_view OcclusionProxyFragment = R"(
+[shader("fragment")]
+void main()
+{
+}
+)";
+} // namespace luvk::Shaders
@@ -0,0 +1,46 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <string_view>
+
+namespace luvk::Shaders
+{
+    constexpr std::string_view VertexCompression = R"(
+struct VertexDequantization
+{
+    float4 PositionOffset;
+    float4 PositionScale;
+    float4 TexCoordOffsetScale;
+};
+
+float3 DequantizePosition(float4 Encoded, VertexDequantization Parameters)
+{
+    return Parameters.PositionOffset.xyz + Encoded.xyz * Parameters.PositionScale.xyz;
+}
+
+float2 DequantizeTexCoord(float2 Encoded, VertexDequantization Parameters)
+{
+    return Parameters.TexCoordOffsetScale.xy + Encoded * Parameters.TexCoordOffsetScale.zw;
+}
+
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 Direction = float3(Encoded, 1.0 - abs(Encoded.x) - abs(Encoded.y));
+
+    if (Direction.z < 0.0)
+    {
+        Direction.xy = (1.0 - abs(Direction.yx)) * select(Direction.xy >= 0.0, 1.0, -1.0);
+    }
+
+    return normalize(Direction);
+}
+
+float4 DecodeTangent(float4 Encoded)
+{
+    return float4(DecodeOctahedral(Encoded.xy), Encoded.w < 0.0 ? -1.0 : 1.0);
+}
+)";
+} // namespace luvk::Shaders
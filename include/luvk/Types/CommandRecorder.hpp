@@ -0,0 +1,101 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <volk.h>
+
+namespace luvk
+{
+    class LUVK_API CommandRecorder
+    {
+    public:
+        static constexpr std::uint32_t MaxDescriptorSets = 8U;
+        static constexpr std::uint32_t MaxDynamicOffsets = 4U;
+        static constexpr std::uint32_t MaxVertexBindings = 8U;
+
+    protected:
+        struct BoundSet
+        {
+            VkDescriptorSet                              Set{VK_NULL_HANDLE};
+            std::uint32_t                                OffsetCount{0};
+            std::array<std::uint32_t, MaxDynamicOffsets> Offsets{};
+        };
+
+        struct BindPointState
+        {
+            VkPipeline                              Pipeline{VK_NULL_HANDLE};
+            VkPipelineLayout                        Layout{VK_NULL_HANDLE};
+            std::array<BoundSet, MaxDescriptorSets> Sets{};
+        };
+
+        VkCommandBuffer                             m_CommandBuffer{VK_NULL_HANDLE};
+        std::array<BindPointState, 2U>              m_BindPoints{};
+        std::array<VkBuffer, MaxVertexBindings>     m_VertexBuffers{};
+        std::array<VkDeviceSize, MaxVertexBindings> m_VertexOffsets{};
+        VkBuffer                                    m_IndexBuffer{VK_NULL_HANDLE};
+        VkDeviceSize                                m_IndexOffset{0};
+        VkIndexType                                 m_IndexType{VK_INDEX_TYPE_MAX_ENUM};
+        bool                                        m_HasViewport{false};
+        bool                                        m_HasScissor{false};
+        VkViewport                                  m_Viewport{};
+        VkRect2D                                    m_Scissor{};
+        std::uint64_t                               m_IssuedCommands{0};
+        std::uint64_t                               m_SkippedCommands{0};
+
+    public:
+        CommandRecorder() = delete;
+        explicit CommandRecorder(VkCommandBuffer CommandBuffer) noexcept;
+
+        void Invalidate() noexcept;
+        void InvalidateDescriptorSet(VkPipelineBindPoint BindPoint, std::uint32_t SetIndex) noexcept;
+
+        bool BindPipeline(VkPipelineBindPoint BindPoint, VkPipeline Pipeline, VkPipelineLayout Layout);
+
+        bool BindDescriptorSet(VkPipelineBindPoint            BindPoint,
+                               VkPipelineLayout               Layout,
+                               std::uint32_t                  SetIndex,
+                               VkDescriptorSet                Set,
+                               std::span<const std::uint32_t> DynamicOffsets = {});
+
+        bool BindVertexBuffers(std::uint32_t FirstBinding, std::span<const VkBuffer> Buffers, std::span<const VkDeviceSize> Offsets);
+        bool BindIndexBuffer(VkBuffer Buffer, VkDeviceSize Offset, VkIndexType IndexType);
+        bool SetViewport(const VkViewport& Viewport);
+        bool SetScissor(const VkRect2D& Scissor);
+
+        void PushConstants(VkPipelineLayout Layout, VkShaderStageFlags Stages, std::uint32_t Offset, std::span<const std::byte> Data);
+
+        void PipelineBarrier(VkPipelineStageFlags SourceStage,
+                             VkAccessFlags        SourceAccess,
+                             VkPipelineStageFlags TargetStage,
+                             VkAccessFlags        TargetAccess);
+
+        [[nodiscard]] constexpr VkCommandBuffer GetHandle() const noexcept
+        {
+            return m_CommandBuffer;
+        }
+
+        [[nodiscard]] constexpr operator VkCommandBuffer() const noexcept
+        {
+            return m_CommandBuffer;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t GetIssuedCommands() const noexcept
+        {
+            return m_IssuedCommands;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t GetSkippedCommands() const noexcept
+        {
+            return m_SkippedCommands;
+        }
+
+    protected:
+        [[nodiscard]] BindPointState& GetState(VkPipelineBindPoint BindPoint);
+    };
+} // namespace luvk
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 #include <volk.h>
+#include "luvk/Constants/Rendering.hpp"
 
 namespace luvk
 {
@@ -17,13 +19,20 @@ namespace luvk
     class Device;
     class DescriptorPool;
     class Memory;
+    class UniformArena;
+    class CommandRecorder;
 
     class LUVK_API Material
     {
     protected:
-        std::shared_ptr<Pipeline>      m_Pipeline{};
-        std::shared_ptr<DescriptorSet> m_DescriptorSet{};
-        std::shared_ptr<Texture>       m_Texture{};
+        bool                                                              m_UsePushDescriptors{false};
+        std::uint32_t                                                     m_UniformBinding{0};
+        VkDeviceSize                                                      m_UniformRange{0};
+        std::shared_ptr<Device>                                           m_Device{};
+        std::shared_ptr<Pipeline>                                         m_Pipeline{};
+        std::array<std::shared_ptr<DescriptorSet>, Constants::ImageCount> m_DescriptorSets{};
+        std::shared_ptr<Texture>                                          m_Texture{};
+        std::shared_ptr<UniformArena>                                     m_UniformArena{};
 
     public:
         constexpr Material() = default;
@@ -33,23 +42,40 @@ namespace luvk
                         const std::shared_ptr<Memory>&         Memory,
                         const std::shared_ptr<Pipeline>&       PipelineObj);
 
-        void AllocateDescriptorSet(std::span<const VkDescriptorSetLayoutBinding> Bindings) const;
+        void AllocateDescriptorSet(std::span<const VkDescriptorSetLayoutBinding> Bindings, bool PreferPushDescriptors = false);
 
-        void Bind(VkCommandBuffer CommandBuffer) const;
+        void Bind(CommandRecorder& Recorder, std::uint32_t FrameIndex, std::span<const std::uint32_t> DynamicOffsets = {}) const;
 
         void SetPipeline(const std::shared_ptr<Pipeline>& PipelineObj);
         void SetDescriptorSet(const std::shared_ptr<DescriptorSet>& DescriptorSetObj);
+        void SetDescriptorSet(const std::shared_ptr<DescriptorSet>& DescriptorSetObj, std::uint32_t FrameIndex);
         void SetTexture(const std::shared_ptr<Texture>& TextureObj);
-        void SetUniformBuffer(const std::shared_ptr<Buffer>& BufferObj, std::uint32_t Binding = 0) const;
+        void SetUniformBuffer(const std::shared_ptr<Buffer>& BufferObj, std::uint32_t FrameIndex, std::uint32_t Binding = 0) const;
+        void SetUniformArena(const std::shared_ptr<UniformArena>& Arena, VkDeviceSize Range, std::uint32_t Binding = 0);
+
+        [[nodiscard]] constexpr bool UsesPushDescriptors() const noexcept
+        {
+            return m_UsePushDescriptors;
+        }
 
         [[nodiscard]] std::shared_ptr<Pipeline> GetPipeline() const noexcept
         {
             return m_Pipeline;
         }
 
-        [[nodiscard]] std::shared_ptr<DescriptorSet> GetDescriptor() const noexcept
+        [[nodiscard]] std::shared_ptr<UniformArena> GetUniformArena() const noexcept
+        {
+            return m_UniformArena;
+        }
+
+        [[nodiscard]] constexpr VkDeviceSize GetUniformRange() const noexcept
+        {
+            return m_UniformRange;
+        }
+
+        [[nodiscard]] std::shared_ptr<DescriptorSet> GetDescriptor(const std::uint32_t FrameIndex = 0) const noexcept
         {
-            return m_DescriptorSet;
+            return FrameIndex < Constants::ImageCount ? m_DescriptorSets.at(FrameIndex) : nullptr;
         }
     };
 } // namespace luvk
@@ -5,12 +5,22 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
 #include <span>
+#include <utility>
 #include <vector>
 #include <volk.h>
 #include "luvk/Constants/Rendering.hpp"
+#include "luvk/Libraries/GeometryOptimizer.hpp"
+#include "luvk/Libraries/VertexCompression.hpp"
+#include "luvk/Modules/InstanceCulling.hpp"
+#include "luvk/Modules/Meshlets.hpp"
+#include "luvk/Modules/OcclusionQueries.hpp"
+#include "luvk/Modules/RenderQueue.hpp"
 #include "luvk/Types/Transform.hpp"
+#include "luvk/Types/TransformBatch.hpp"
+#include "luvk/Types/TransformHierarchy.hpp"
 
 namespace luvk
 {
@@ -18,6 +28,7 @@ namespace luvk
     class Device;
     class Memory;
     class Material;
+    class CommandRecorder;
 
     class LUVK_API Mesh
     {
@@ -31,6 +42,9 @@ namespace luvk
     protected:
         VkIndexType m_IndexType{VK_INDEX_TYPE_UINT16};
 
+        bool m_StaticVertices{false};
+        bool m_StaticIndices{false};
+
         std::uint32_t m_DispatchX{1};
         std::uint32_t m_DispatchY{1};
         std::uint32_t m_DispatchZ{1};
@@ -38,23 +52,39 @@ namespace luvk
         std::uint32_t m_IndexCount{0};
         std::uint32_t m_VertexCount{0};
         std::uint32_t m_InstanceCount{0};
+        std::uint32_t m_InstanceStride{0};
 
         std::shared_ptr<Device> m_Device{};
         std::shared_ptr<Memory> m_Memory{};
 
         std::shared_ptr<Material> m_Material{};
 
+        std::shared_ptr<InstanceCulling> m_Culling{};
+        std::uint32_t                    m_CullingTarget{0};
+
+        std::shared_ptr<OcclusionQueries> m_Occlusion{};
+        std::uint32_t                     m_OcclusionQuery{0};
+        InstanceCulling::InstanceBounds   m_OcclusionBounds{};
+        OcclusionQueries::ProxyCallback   m_OcclusionProxy{};
+
+        std::shared_ptr<Meshlets> m_Meshlets{};
+        std::uint32_t             m_MeshletGeometry{0};
+        std::array<float, 16>     m_MeshletModel{1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F};
+
         std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_VertexBuffers{};
         std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_IndexBuffers{};
         std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_InstanceBuffers{};
         std::array<std::shared_ptr<Buffer>, Constants::ImageCount> m_UniformBuffers{};
 
+        VertexDequantization m_Dequantization{};
+
+        std::vector<std::byte> m_UniformData{};
         std::vector<std::byte> m_PushConstantData{};
 
     public:
         Mesh() = delete;
         explicit Mesh(const std::shared_ptr<Device>& Device, const std::shared_ptr<Memory>& Memory);
-        virtual  ~Mesh() = default;
+        virtual  ~Mesh();
 
         void SetMaterial(const std::shared_ptr<Material>& MaterialObj)
         {
@@ -66,18 +96,81 @@ namespace luvk
             return m_Material;
         }
 
+        void EnableCulling(const std::shared_ptr<InstanceCulling>& Culling);
+        void DisableCulling();
+
+        [[nodiscard]] bool IsCullingEnabled() const noexcept
+        {
+            return m_Culling != nullptr;
+        }
+
+        void EnableOcclusionQuery(const std::shared_ptr<OcclusionQueries>& Occlusion);
+        void DisableOcclusionQuery();
+
+        [[nodiscard]] bool IsOcclusionQueryEnabled() const noexcept
+        {
+            return m_Occlusion != nullptr;
+        }
+
+        void SetOcclusionBounds(const InstanceCulling::InstanceBounds& Bounds)
+        {
+            m_OcclusionBounds = Bounds;
+        }
+
+        void SetOcclusionProxy(OcclusionQueries::ProxyCallback Proxy)
+        {
+            m_OcclusionProxy = std::move(Proxy);
+        }
+
+        void EnableMeshlets(const std::shared_ptr<Meshlets>& MeshletsModule, std::uint32_t GeometryIndex);
+        void DisableMeshlets();
+
+        [[nodiscard]] bool IsMeshletsEnabled() const noexcept
+        {
+            return m_Meshlets != nullptr;
+        }
+
+        void SetMeshletTransform(const std::array<float, 16>& Model)
+        {
+            m_MeshletModel = Model;
+        }
+
+        [[nodiscard]] bool IsStaticGeometry() const noexcept
+        {
+            return m_StaticVertices && (m_StaticIndices || m_IndexCount == 0U);
+        }
+
+        [[nodiscard]] const VertexDequantization& GetDequantization() const noexcept
+        {
+            return m_Dequantization;
+        }
+
     protected:
         void UploadVertices(std::span<const std::byte> Data, std::uint32_t VertexCount, std::uint32_t FrameIndex);
+        void UploadVertices(const CompressedVertices& Vertices, std::uint32_t FrameIndex);
         void UploadIndices(std::span<const std::uint16_t> Data, std::uint32_t FrameIndex);
         void UploadIndices(std::span<const std::uint32_t> Data, std::uint32_t FrameIndex);
+        void UploadGeometry(const OptimizedGeometry& Geometry, std::uint32_t VertexStride, std::uint32_t FrameIndex);
+        void UploadStaticGeometry(const GeometryOptimizationArguments& Arguments);
+        void UploadStaticVertices(std::span<const std::byte> Data, std::uint32_t VertexCount);
+        void UploadStaticIndices(std::span<const std::uint16_t> Data);
+        void UploadStaticIndices(std::span<const std::uint32_t> Data);
         void UpdateInstances(std::span<const std::byte> Data, std::uint32_t Count, std::uint32_t FrameIndex);
+        void UpdateInstances(const TransformBatch& Transforms, TransformBatch::MatrixLayout Layout, std::uint32_t FrameIndex);
+        void UpdateInstances(const TransformHierarchy& Hierarchy, TransformBatch::MatrixLayout Layout, std::uint32_t FrameIndex);
+        void WriteInstanceMatrices(std::size_t Count, TransformBatch::MatrixLayout Layout, std::uint32_t FrameIndex, const std::function<void(std::span<std::byte>)>& Writer);
+        void UpdateInstanceBounds(std::span<const InstanceCulling::InstanceBounds> Bounds, std::uint32_t FrameIndex) const;
         void UpdateUniformBuffer(std::span<const std::byte> Data, std::uint32_t FrameIndex);
 
         void SetDispatchCount(std::uint32_t X, std::uint32_t Y, std::uint32_t Z);
         void SetPushConstantData(std::span<const std::byte> Data);
 
+        void RecordDraw(CommandRecorder& Recorder, std::uint32_t CurrentFrame) const;
+
     public:
         virtual void Tick(float DeltaTime);
-        virtual void Render(VkCommandBuffer CommandBuffer, std::uint32_t CurrentFrame) const;
+        virtual void Render(CommandRecorder& Recorder, std::uint32_t CurrentFrame) const;
+        virtual void RenderOcclusionProxy(CommandRecorder& Recorder, std::uint32_t CurrentFrame) const;
+        virtual void Submit(RenderQueue& Queue, float ViewDepth, RenderQueue::Pass Pass = RenderQueue::Pass::Opaque) const;
     };
 }
@@ -0,0 +1,97 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "luvk/Types/Transform.hpp"
+
+namespace luvk
+{
+    class ThreadPool;
+
+    class LUVK_API TransformBatch
+    {
+    public:
+        enum class RotationMode : std::uint8_t
+        {
+            Euler,
+            Quaternion
+        };
+
+        enum class MatrixLayout : std::uint8_t
+        {
+            Affine3x4,
+            Matrix4x4
+        };
+
+        static constexpr std::uint32_t BlockSize = 8U;
+
+    protected:
+        RotationMode                m_RotationMode{RotationMode::Euler};
+        std::vector<float>          m_PositionX{};
+        std::vector<float>          m_PositionY{};
+        std::vector<float>          m_PositionZ{};
+        std::vector<float>          m_RotationX{};
+        std::vector<float>          m_RotationY{};
+        std::vector<float>          m_RotationZ{};
+        std::vector<float>          m_RotationW{};
+        std::vector<float>          m_ScaleX{};
+        std::vector<float>          m_ScaleY{};
+        std::vector<float>          m_ScaleZ{};
+        std::uint32_t               m_MinTransformsPerTask{16384U};
+        std::shared_ptr<ThreadPool> m_ThreadPoolModule{};
+
+    public:
+        TransformBatch() = default;
+        explicit TransformBatch(RotationMode Mode, const std::shared_ptr<ThreadPool>& ThreadPoolModule = nullptr);
+
+        void Reserve(std::size_t Count);
+        void Resize(std::size_t Count);
+        void Clear() noexcept;
+
+        std::uint32_t Add(const Transform& Value);
+        std::uint32_t Add(const std::array<float, 3>& Position, const std::array<float, 4>& Rotation, const std::array<float, 3>& Scale);
+
+        void Set(std::uint32_t Index, const Transform& Value);
+        void Set(std::uint32_t Index, const std::array<float, 3>& Position, const std::array<float, 4>& Rotation, const std::array<float, 3>& Scale);
+        void SetPosition(std::uint32_t Index, const std::array<float, 3>& Position);
+        void SetScale(std::uint32_t Index, const std::array<float, 3>& Scale);
+
+        void Build(std::span<std::byte> Output, MatrixLayout Layout, std::size_t Stride = 0U) const;
+        void BuildRange(std::uint32_t Begin, std::uint32_t End, std::span<std::byte> Output, MatrixLayout Layout, std::size_t Stride = 0U) const;
+
+        void SetMinTransformsPerTask(const std::uint32_t Count) noexcept
+        {
+            m_MinTransformsPerTask = std::max(Count, BlockSize);
+        }
+
+        [[nodiscard]] static constexpr std::size_t GetMatrixSize(const MatrixLayout Layout) noexcept
+        {
+            return Layout == MatrixLayout::Affine3x4 ? sizeof(float) * 12U : sizeof(float) * 16U;
+        }
+
+        [[nodiscard]] constexpr RotationMode GetRotationMode() const noexcept
+        {
+            return m_RotationMode;
+        }
+
+        [[nodiscard]] constexpr std::size_t GetCount() const noexcept
+        {
+            return std::size(m_PositionX);
+        }
+
+        [[nodiscard]] static std::string_view GetBackendName() noexcept;
+
+    protected:
+        void BuildBlocks(std::uint32_t Begin, std::uint32_t End, std::byte* Output, MatrixLayout Layout, std::size_t Stride) const noexcept;
+    };
+} // namespace luvk
@@ -0,0 +1,98 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+#include "luvk/Types/Transform.hpp"
+#include "luvk/Types/TransformBatch.hpp"
+
+namespace luvk
+{
+    class ThreadPool;
+
+    class LUVK_API TransformHierarchy
+    {
+    public:
+        using Matrix = std::array<float, 12>;
+
+        static constexpr std::uint32_t InvalidNode = std::numeric_limits<std::uint32_t>::max();
+
+    protected:
+        bool                        m_TopologyDirty{false};
+        bool                        m_LocalChanged{false};
+        TransformBatch              m_Locals{};
+        std::vector<std::uint32_t>  m_Parents{};
+        std::vector<std::uint8_t>   m_LocalDirty{};
+        std::vector<Matrix>         m_LocalMatrices{};
+        std::vector<std::uint32_t>  m_Order{};
+        std::vector<std::uint32_t>  m_Slots{};
+        std::vector<std::uint32_t>  m_OrderParents{};
+        std::vector<std::uint32_t>  m_Levels{};
+        std::vector<std::uint8_t>   m_WorldDirty{};
+        std::vector<Matrix>         m_World{};
+        std::uint32_t               m_UpdatedCount{0};
+        std::uint32_t               m_MinNodesPerTask{4096U};
+        std::shared_ptr<ThreadPool> m_ThreadPoolModule{};
+
+    public:
+        TransformHierarchy() = default;
+        explicit TransformHierarchy(TransformBatch::RotationMode Mode, const std::shared_ptr<ThreadPool>& ThreadPoolModule = nullptr);
+
+        void Reserve(std::size_t Count);
+        void Clear() noexcept;
+
+        std::uint32_t AddNode(std::uint32_t Parent = InvalidNode, const Transform& Local = {});
+
+        void SetParent(std::uint32_t Node, std::uint32_t Parent);
+        void SetLocal(std::uint32_t Node, const Transform& Local);
+        void SetLocal(std::uint32_t Node, const std::array<float, 3>& Position, const std::array<float, 4>& Rotation, const std::array<float, 3>& Scale);
+        void SetPosition(std::uint32_t Node, const std::array<float, 3>& Position);
+        void SetScale(std::uint32_t Node, const std::array<float, 3>& Scale);
+
+        std::uint32_t Update();
+
+        void Build(std::span<std::byte> Output, TransformBatch::MatrixLayout Layout, std::size_t Stride = 0U) const;
+
+        [[nodiscard]] const Matrix& GetWorldMatrix(std::uint32_t Node) const;
+
+        void SetMinNodesPerTask(const std::uint32_t Count) noexcept
+        {
+            m_MinNodesPerTask = std::max(Count, TransformBatch::BlockSize);
+        }
+
+        [[nodiscard]] std::uint32_t GetParent(const std::uint32_t Node) const
+        {
+            return m_Parents.at(Node);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetCount() const noexcept
+        {
+            return std::size(m_Parents);
+        }
+
+        [[nodiscard]] constexpr std::size_t GetDepth() const noexcept
+        {
+            return std::empty(m_Levels) ? 0U : std::size(m_Levels) - 1U;
+        }
+
+        [[nodiscard]] constexpr std::uint32_t GetUpdatedCount() const noexcept
+        {
+            return m_UpdatedCount;
+        }
+
+    protected:
+        void MarkLocalDirty(std::uint32_t Node);
+        void RebuildOrder();
+        void UpdateLocalMatrices();
+        void UpdateWorldMatrices();
+    };
+} // namespace luvk
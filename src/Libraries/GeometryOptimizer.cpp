@@ -0,0 +1,521 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Libraries/GeometryOptimizer.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+using Float3 = std::array<float, 3>;
+
+constexpr std::uint32_t g_ScoringCacheSize   = 32U;
+constexpr std::uint32_t g_SimulatedCacheSize = 16U;
+constexpr std::uint32_t g_MaxScoredValence   = 64U;
+constexpr std::uint32_t g_InvalidIndex       = std::numeric_limits<std::uint32_t>::max();
+constexpr float         g_CacheDecayPower    = 1.5F;
+constexpr float         g_LastTriangleScore  = 0.75F;
+constexpr float         g_ValenceBoostScale  = 2.F;
+constexpr float         g_ValenceBoostPower  = 0.5F;
+
+class VertexScoreTable
+{
+    std::array<float, g_ScoringCacheSize + 1U> m_CacheScores{};
+    std::array<float, g_MaxScoredValence>      m_ValenceScores{};
+
+public:
+    VertexScoreTable()
+    {
+        for (std::uint32_t Position = 0U; Position < g_ScoringCacheSize; ++Position)
+        {
+            m_CacheScores.at(Position) = Position < 3U
+                                             ? g_LastTriangleScore
+                                             : std::pow(1.F - static_cast<float>(Position - 3U) / static_cast<float>(g_ScoringCacheSize - 3U), g_CacheDecayPower);
+        }
+
+        for (std::uint32_t Valence = 1U; Valence < g_MaxScoredValence; ++Valence)
+        {
+            m_ValenceScores.at(Valence) = g_ValenceBoostScale * std::pow(static_cast<float>(Valence), -g_ValenceBoostPower);
+        }
+    }
+
+    [[nodiscard]] float Get(const std::uint32_t CachePosition, const std::uint32_t Valence) const noexcept
+    {
+        if (Valence == 0U)
+        {
+            return -1.F;
+        }
+
+        const float ValenceScore = Valence < g_MaxScoredValence
+                                       ? m_ValenceScores[Valence]
+                                       : g_ValenceBoostScale * std::pow(static_cast<float>(Valence), -g_ValenceBoostPower);
+
+        return m_CacheScores[std::min(CachePosition, g_ScoringCacheSize)] + ValenceScore;
+    }
+};
+
+class CacheSimulator
+{
+    std::vector<std::uint32_t> m_Timestamps{};
+    std::uint32_t              m_Time{0};
+    std::uint32_t              m_CacheSize{0};
+
+public:
+    CacheSimulator(const std::uint32_t VertexCount, const std::uint32_t CacheSize)
+        : m_Timestamps(VertexCount, 0U),
+          m_Time(CacheSize + 1U),
+          m_CacheSize(CacheSize) {}
+
+    void Reset() noexcept
+    {
+        m_Time += m_CacheSize + 1U;
+    }
+
+    std::uint32_t Process(const std::uint32_t* const Triangle) noexcept
+    {
+        std::uint32_t Misses = 0U;
+
+        for (std::uint32_t Corner = 0U; Corner < 3U; ++Corner)
+        {
+            if (std::uint32_t& Timestamp = m_Timestamps[Triangle[Corner]];
+                m_Time - Timestamp > m_CacheSize)
+            {
+                Timestamp = m_Time++;
+                ++Misses;
+            }
+        }
+
+        return Misses;
+    }
+};
+
+static void ValidateIndices(const std::span<const std::uint32_t> Indices, const std::uint32_t VertexCount)
+{
+    if (std::size(Indices) % 3U != 0U)
+    {
+        throw std::runtime_error("Geometry optimization requires a triangle list.");
+    }
+
+    if (std::ranges::any_of(Indices,
+                            [VertexCount](const std::uint32_t Index)
+                            {
+                                return Index >= VertexCount;
+                            }))
+    {
+        throw std::runtime_error("Geometry index references a vertex out of range.");
+    }
+}
+
+static Float3 ReadPosition(const std::span<const std::byte> Vertices, const std::uint32_t VertexStride, const std::uint32_t PositionOffset, const std::uint32_t Vertex) noexcept
+{
+    Float3 Position{};
+    std::memcpy(std::data(Position), std::data(Vertices) + static_cast<std::size_t>(Vertex) * VertexStride + PositionOffset, sizeof(Position));
+    return Position;
+}
+
+void luvk::OptimizeVertexCache(const std::span<std::uint32_t> Indices, const std::uint32_t VertexCount)
+{
+    ValidateIndices(Indices, VertexCount);
+
+    const std::size_t TriangleCount = std::size(Indices) / 3U;
+
+    if (TriangleCount == 0U)
+    {
+        return;
+    }
+
+    static const VertexScoreTable ScoreTable{};
+
+    std::vector<std::uint32_t> Valence(VertexCount, 0U);
+
+    for (const std::uint32_t IndexIt : Indices)
+    {
+        ++Valence[IndexIt];
+    }
+
+    std::vector<std::uint32_t> Offsets(VertexCount + 1U, 0U);
+    std::inclusive_scan(std::begin(Valence), std::end(Valence), std::begin(Offsets) + 1);
+
+    std::vector<std::uint32_t> Adjacency(std::size(Indices));
+    std::vector<std::uint32_t> Remaining(VertexCount, 0U);
+
+    for (std::size_t Triangle = 0U; Triangle < TriangleCount; ++Triangle)
+    {
+        for (std::size_t Corner = 0U; Corner < 3U; ++Corner)
+        {
+            const std::uint32_t Vertex                     = Indices[Triangle * 3U + Corner];
+            Adjacency[Offsets[Vertex] + Remaining[Vertex]++] = static_cast<std::uint32_t>(Triangle);
+        }
+    }
+
+    std::vector<std::uint32_t> CachePositions(VertexCount, g_ScoringCacheSize);
+    std::vector<float>         VertexScores(VertexCount);
+
+    for (std::uint32_t Vertex = 0U; Vertex < VertexCount; ++Vertex)
+    {
+        VertexScores[Vertex] = ScoreTable.Get(g_ScoringCacheSize, Remaining[Vertex]);
+    }
+
+    std::vector<float>        TriangleScores(TriangleCount);
+    std::vector<std::uint8_t> Emitted(TriangleCount, 0U);
+
+    auto ScoreTriangle = [&](const std::size_t Triangle)
+    {
+        return VertexScores[Indices[Triangle * 3U]] + VertexScores[Indices[Triangle * 3U + 1U]] + VertexScores[Indices[Triangle * 3U + 2U]];
+    };
+
+    std::uint32_t BestTriangle = 0U;
+
+    for (std::size_t Triangle = 0U; Triangle < TriangleCount; ++Triangle)
+    {
+        TriangleScores[Triangle] = ScoreTriangle(Triangle);
+
+        if (TriangleScores[Triangle] > TriangleScores[BestTriangle])
+        {
+            BestTriangle = static_cast<std::uint32_t>(Triangle);
+        }
+    }
+
+    std::vector<std::uint32_t> Output(std::size(Indices));
+    std::vector<std::uint32_t> Cache{};
+    std::vector<std::uint32_t> NextCache{};
+    std::size_t                Cursor = 0U;
+
+    Cache.reserve(g_ScoringCacheSize + 3U);
+    NextCache.reserve(g_ScoringCacheSize + 3U);
+
+    for (std::size_t Written = 0U; Written < TriangleCount; ++Written)
+    {
+        if (BestTriangle == g_InvalidIndex)
+        {
+            while (Emitted[Cursor] != 0U)
+            {
+                ++Cursor;
+            }
+
+            BestTriangle = static_cast<std::uint32_t>(Cursor);
+        }
+
+        const std::uint32_t* const Triangle = &Indices[static_cast<std::size_t>(BestTriangle) * 3U];
+
+        std::copy_n(Triangle, 3U, &Output[Written * 3U]);
+        Emitted[BestTriangle] = 1U;
+
+        NextCache.clear();
+
+        for (std::size_t Corner = 0U; Corner < 3U; ++Corner)
+        {
+            const std::uint32_t  Vertex = Triangle[Corner];
+            std::uint32_t* const Begin  = &Adjacency[Offsets[Vertex]];
+            std::uint32_t* const Last   = Begin + --Remaining[Vertex];
+
+            std::iter_swap(std::find(Begin, Last, BestTriangle), Last);
+
+            if (std::ranges::find(NextCache, Vertex) == std::end(NextCache))
+            {
+                NextCache.push_back(Vertex);
+            }
+        }
+
+        for (const std::uint32_t VertexIt : Cache)
+        {
+            if (std::ranges::find(NextCache, VertexIt) == std::end(NextCache))
+            {
+                NextCache.push_back(VertexIt);
+            }
+        }
+
+        for (std::uint32_t Position = 0U; Position < std::size(NextCache); ++Position)
+        {
+            const std::uint32_t Vertex = NextCache[Position];
+            CachePositions[Vertex]     = std::min(Position, g_ScoringCacheSize);
+            VertexScores[Vertex]       = ScoreTable.Get(CachePositions[Vertex], Remaining[Vertex]);
+        }
+
+        BestTriangle    = g_InvalidIndex;
+        float BestScore = -1.F;
+
+        for (const std::uint32_t VertexIt : NextCache)
+        {
+            for (std::uint32_t Entry = Offsets[VertexIt]; Entry < Offsets[VertexIt] + Remaining[VertexIt]; ++Entry)
+            {
+                const std::uint32_t Candidate = Adjacency[Entry];
+                TriangleScores[Candidate]     = ScoreTriangle(Candidate);
+
+                if (TriangleScores[Candidate] > BestScore)
+                {
+                    BestScore    = TriangleScores[Candidate];
+                    BestTriangle = Candidate;
+                }
+            }
+        }
+
+        NextCache.resize(std::min<std::size_t>(std::size(NextCache), g_ScoringCacheSize));
+        std::swap(Cache, NextCache);
+    }
+
+    std::ranges::copy(Output, std::begin(Indices));
+}
+
+void luvk::OptimizeOverdraw(const std::span<std::uint32_t>   Indices,
+                            const std::span<const std::byte> Vertices,
+                            const std::uint32_t              VertexStride,
+                            const std::uint32_t              PositionOffset,
+                            const float                      Threshold)
+{
+    if (VertexStride < PositionOffset + sizeof(Float3))
+    {
+        throw std::runtime_error("Overdraw optimization requires a float3 position per vertex.");
+    }
+
+    const auto VertexCount = static_cast<std::uint32_t>(std::size(Vertices) / VertexStride);
+    ValidateIndices(Indices, VertexCount);
+
+    const std::size_t TriangleCount = std::size(Indices) / 3U;
+
+    if (TriangleCount < 2U)
+    {
+        return;
+    }
+
+    CacheSimulator             Simulator(VertexCount, g_SimulatedCacheSize);
+    std::vector<std::uint32_t> HardBoundaries{0U};
+
+    for (std::size_t Triangle = 0U; Triangle < TriangleCount; ++Triangle)
+    {
+        if (Simulator.Process(&Indices[Triangle * 3U]) == 3U && Triangle > 0U)
+        {
+            HardBoundaries.push_back(static_cast<std::uint32_t>(Triangle));
+        }
+    }
+
+    HardBoundaries.push_back(static_cast<std::uint32_t>(TriangleCount));
+
+    std::vector<std::uint32_t> Clusters{};
+
+    for (std::size_t Hard = 0U; Hard + 1U < std::size(HardBoundaries); ++Hard)
+    {
+        const std::uint32_t Begin = HardBoundaries[Hard];
+        const std::uint32_t End   = HardBoundaries[Hard + 1U];
+
+        Simulator.Reset();
+
+        std::uint32_t ClusterMisses = 0U;
+
+        for (std::uint32_t Triangle = Begin; Triangle < End; ++Triangle)
+        {
+            ClusterMisses += Simulator.Process(&Indices[static_cast<std::size_t>(Triangle) * 3U]);
+        }
+
+        const float ClusterThreshold = Threshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Begin);
+
+        Simulator.Reset();
+        Clusters.push_back(Begin);
+
+        std::uint32_t Start  = Begin;
+        std::uint32_t Misses = 0U;
+
+        for (std::uint32_t Triangle = Begin; Triangle + 1U < End; ++Triangle)
+        {
+            Misses += Simulator.Process(&Indices[static_cast<std::size_t>(Triangle) * 3U]);
+
+            if (static_cast<float>(Misses) / static_cast<float>(Triangle - Start + 1U) <= ClusterThreshold)
+            {
+                Start  = Triangle + 1U;
+                Misses = 0U;
+
+                Simulator.Reset();
+                Clusters.push_back(Start);
+            }
+        }
+    }
+
+    Clusters.push_back(static_cast<std::uint32_t>(TriangleCount));
+
+    const std::size_t   ClusterCount = std::size(Clusters) - 1U;
+    std::vector<Float3> Centroids(ClusterCount, Float3{});
+    std::vector<Float3> Normals(ClusterCount, Float3{});
+    std::vector<float>  Areas(ClusterCount, 0.F);
+    Float3              MeshCentroid{};
+    float               MeshArea = 0.F;
+
+    for (std::size_t Cluster = 0U; Cluster < ClusterCount; ++Cluster)
+    {
+        for (std::uint32_t Triangle = Clusters[Cluster]; Triangle < Clusters[Cluster + 1U]; ++Triangle)
+        {
+            const std::size_t Base = static_cast<std::size_t>(Triangle) * 3U;
+            const Float3      A    = ReadPosition(Vertices, VertexStride, PositionOffset, Indices[Base]);
+            const Float3      B    = ReadPosition(Vertices, VertexStride, PositionOffset, Indices[Base + 1U]);
+            const Float3      C    = ReadPosition(Vertices, VertexStride, PositionOffset, Indices[Base + 2U]);
+
+            const Float3 AB{B[0] - A[0], B[1] - A[1], B[2] - A[2]};
+            const Float3 AC{C[0] - A[0], C[1] - A[1], C[2] - A[2]};
+            const Float3 Normal{AB[1] * AC[2] - AB[2] * AC[1], AB[2] * AC[0] - AB[0] * AC[2], AB[0] * AC[1] - AB[1] * AC[0]};
+            const float  Area = std::sqrt(Normal[0] * Normal[0] + Normal[1] * Normal[1] + Normal[2] * Normal[2]);
+
+            for (std::size_t Axis = 0U; Axis < 3U; ++Axis)
+            {
+                const float Center = (A[Axis] + B[Axis] + C[Axis]) / 3.F;
+
+                Centroids[Cluster][Axis] += Center * Area;
+                Normals[Cluster][Axis] += Normal[Axis];
+                MeshCentroid[Axis] += Center * Area;
+            }
+
+            Areas[Cluster] += Area;
+            MeshArea += Area;
+        }
+    }
+
+    std::vector<float> SortKeys(ClusterCount, 0.F);
+
+    for (std::size_t Cluster = 0U; Cluster < ClusterCount; ++Cluster)
+    {
+        const Float3& Normal = Normals[Cluster];
+        const float   Length = std::sqrt(Normal[0] * Normal[0] + Normal[1] * Normal[1] + Normal[2] * Normal[2]);
+
+        if (Areas[Cluster] <= 0.F || Length <= 0.F || MeshArea <= 0.F)
+        {
+            continue;
+        }
+
+        for (std::size_t Axis = 0U; Axis < 3U; ++Axis)
+        {
+            SortKeys[Cluster] += (Centroids[Cluster][Axis] / Areas[Cluster] - MeshCentroid[Axis] / MeshArea) * Normal[Axis] / Length;
+        }
+    }
+
+    std::vector<std::uint32_t> Order(ClusterCount);
+    std::iota(std::begin(Order), std::end(Order), 0U);
+    std::ranges::stable_sort(Order,
+                             [&SortKeys](const std::uint32_t Left, const std::uint32_t Right)
+                             {
+                                 return SortKeys[Left] > SortKeys[Right];
+                             });
+
+    std::vector<std::uint32_t> Output{};
+    Output.reserve(std::size(Indices));
+
+    for (const std::uint32_t ClusterIt : Order)
+    {
+        Output.insert(std::end(Output),
+                      std::begin(Indices) + static_cast<std::ptrdiff_t>(Clusters[ClusterIt]) * 3,
+                      std::begin(Indices) + static_cast<std::ptrdiff_t>(Clusters[ClusterIt + 1U]) * 3);
+    }
+
+    assert(std::size(Output) == std::size(Indices));
+    std::ranges::copy(Output, std::begin(Indices));
+}
+
+std::uint32_t luvk::OptimizeVertexFetch(const std::span<std::uint32_t> Indices, const std::span<std::byte> Vertices, const std::uint32_t VertexStride)
+{
+    if (VertexStride == 0U)
+    {
+        throw std::runtime_error("Vertex fetch optimization requires a vertex stride.");
+    }
+
+    const auto VertexCount = static_cast<std::uint32_t>(std::size(Vertices) / VertexStride);
+    ValidateIndices(Indices, VertexCount);
+
+    std::vector<std::uint32_t> Remap(VertexCount, g_InvalidIndex);
+    std::uint32_t              NextVertex = 0U;
+
+    for (std::uint32_t& IndexIt : Indices)
+    {
+        if (Remap[IndexIt] == g_InvalidIndex)
+        {
+            Remap[IndexIt] = NextVertex++;
+        }
+
+        IndexIt = Remap[IndexIt];
+    }
+
+    const std::vector Source(std::begin(Vertices), std::end(Vertices));
+
+    for (std::uint32_t Vertex = 0U; Vertex < VertexCount; ++Vertex)
+    {
+        if (Remap[Vertex] != g_InvalidIndex)
+        {
+            std::memcpy(std::data(Vertices) + static_cast<std::size_t>(Remap[Vertex]) * VertexStride,
+                        std::data(Source) + static_cast<std::size_t>(Vertex) * VertexStride,
+                        VertexStride);
+        }
+    }
+
+    return NextVertex;
+}
+
+luvk::OptimizedGeometry luvk::OptimizeGeometry(const GeometryOptimizationArguments& Arguments)
+{
+    if (Arguments.VertexStride < Arguments.PositionOffset + sizeof(Float3))
+    {
+        throw std::runtime_error("Geometry optimization requires a float3 position per vertex.");
+    }
+
+    OptimizedGeometry Result{.Vertices = {std::begin(Arguments.Vertices), std::end(Arguments.Vertices)},
+                             .Indices = {std::begin(Arguments.Indices), std::end(Arguments.Indices)},
+                             .VertexCount = static_cast<std::uint32_t>(std::size(Arguments.Vertices) / Arguments.VertexStride)};
+
+    Result.Vertices.resize(static_cast<std::size_t>(Result.VertexCount) * Arguments.VertexStride);
+
+    if (Arguments.VertexCache)
+    {
+        OptimizeVertexCache(Result.Indices, Result.VertexCount);
+    }
+
+    if (Arguments.Overdraw)
+    {
+        OptimizeOverdraw(Result.Indices, Result.Vertices, Arguments.VertexStride, Arguments.PositionOffset, Arguments.OverdrawThreshold);
+    }
+
+    if (Arguments.VertexFetch)
+    {
+        Result.VertexCount = OptimizeVertexFetch(Result.Indices, Result.Vertices, Arguments.VertexStride);
+        Result.Vertices.resize(static_cast<std::size_t>(Result.VertexCount) * Arguments.VertexStride);
+    }
+
+    return Result;
+}
+
+std::vector<std::uint16_t> luvk::ConvertIndicesToUInt16(const std::span<const std::uint32_t> Indices)
+{
+    std::vector<std::uint16_t> Output(std::size(Indices));
+
+    std::ranges::transform(Indices,
+                           std::begin(Output),
+                           [](const std::uint32_t Index)
+                           {
+                               if (Index > std::numeric_limits<std::uint16_t>::max())
+                               {
+                                   throw std::runtime_error("Index does not fit in 16 bits.");
+                               }
+
+                               return static_cast<std::uint16_t>(Index);
+                           });
+
+    return Output;
+}
+
+float luvk::GetAverageCacheMissRatio(const std::span<const std::uint32_t> Indices, const std::uint32_t VertexCount, const std::uint32_t CacheSize)
+{
+    ValidateIndices(Indices, VertexCount);
+
+    if (std::empty(Indices))
+    {
+        return 0.F;
+    }
+
+    CacheSimulator Simulator(VertexCount, CacheSize);
+    std::uint32_t  Misses = 0U;
+
+    for (std::size_t Triangle = 0U; Triangle < std::size(Indices); Triangle += 3U)
+    {
+        Misses += Simulator.Process(&Indices[Triangle]);
+    }
+
+    return static_cast<float>(Misses) / static_cast<float>(std::size(Indices) / 3U);
+}
@@ -0,0 +1,449 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Libraries/VertexCompression.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+struct EncodingInfo
+{
+    VkFormat      Format{VK_FORMAT_UNDEFINED};
+    std::uint32_t Size{0};
+};
+
+constexpr std::uint32_t g_AttributeAlignment = 4U;
+constexpr std::uint16_t g_HalfOne            = 0x3C00U;
+
+static EncodingInfo GetEncodingInfo(const luvk::VertexAttribute Attribute, const luvk::VertexEncoding Encoding) noexcept
+{
+    using luvk::VertexAttribute;
+    using luvk::VertexEncoding;
+
+    switch (Attribute)
+    {
+    case VertexAttribute::Position:
+        switch (Encoding)
+        {
+        case VertexEncoding::Float32: return {VK_FORMAT_R32G32B32_SFLOAT, 12U};
+        case VertexEncoding::Half: return {VK_FORMAT_R16G16B16A16_SFLOAT, 8U};
+        case VertexEncoding::Unorm16: return {VK_FORMAT_R16G16B16A16_UNORM, 8U};
+        default: return {};
+        }
+    case VertexAttribute::Normal:
+        switch (Encoding)
+        {
+        case VertexEncoding::Float32: return {VK_FORMAT_R32G32B32_SFLOAT, 12U};
+        case VertexEncoding::Octahedral16: return {VK_FORMAT_R16G16_SNORM, 4U};
+        case VertexEncoding::Octahedral8: return {VK_FORMAT_R8G8_SNORM, 2U};
+        default: return {};
+        }
+    case VertexAttribute::Tangent:
+        switch (Encoding)
+        {
+        case VertexEncoding::Float32: return {VK_FORMAT_R32G32B32A32_SFLOAT, 16U};
+        case VertexEncoding::Octahedral16: return {VK_FORMAT_R16G16B16A16_SNORM, 8U};
+        case VertexEncoding::Octahedral8: return {VK_FORMAT_R8G8B8A8_SNORM, 4U};
+        default: return {};
+        }
+    case VertexAttribute::TexCoord:
+        switch (Encoding)
+        {
+        case VertexEncoding::Float32: return {VK_FORMAT_R32G32_SFLOAT, 8U};
+        case VertexEncoding::Half: return {VK_FORMAT_R16G16_SFLOAT, 4U};
+        case VertexEncoding::Unorm16: return {VK_FORMAT_R16G16_UNORM, 4U};
+        default: return {};
+        }
+    case VertexAttribute::Color:
+        switch (Encoding)
+        {
+        case VertexEncoding::Float32: return {VK_FORMAT_R32G32B32A32_SFLOAT, 16U};
+        case VertexEncoding::Half: return {VK_FORMAT_R16G16B16A16_SFLOAT, 8U};
+        case VertexEncoding::Unorm8: return {VK_FORMAT_R8G8B8A8_UNORM, 4U};
+        default: return {};
+        }
+    default: return {};
+    }
+}
+
+static std::uint32_t GetSourceComponents(const luvk::VertexAttribute Attribute) noexcept
+{
+    switch (Attribute)
+    {
+    case luvk::VertexAttribute::Position:
+    case luvk::VertexAttribute::Normal: return 3U;
+    case luvk::VertexAttribute::TexCoord: return 2U;
+    default: return 4U;
+    }
+}
+
+static std::uint32_t AlignAttribute(const std::uint32_t Size) noexcept
+{
+    return (Size + g_AttributeAlignment - 1U) & ~(g_AttributeAlignment - 1U);
+}
+
+template <typename Type>
+static Type QuantizeSnorm(const float Value) noexcept
+{
+    constexpr auto Maximum = static_cast<float>(std::numeric_limits<Type>::max());
+    return static_cast<Type>(std::lround(std::clamp(Value, -1.F, 1.F) * Maximum));
+}
+
+template <typename Type>
+static Type QuantizeUnorm(const float Value) noexcept
+{
+    constexpr auto Maximum = static_cast<float>(std::numeric_limits<Type>::max());
+    return static_cast<Type>(std::lround(std::clamp(Value, 0.F, 1.F) * Maximum));
+}
+
+template <typename Type, std::size_t Count>
+static std::byte* WriteComponents(std::byte* const Output, const std::array<Type, Count>& Components) noexcept
+{
+    std::memcpy(Output, std::data(Components), sizeof(Components));
+    return Output + sizeof(Components);
+}
+
+static void EncodeAttribute(const luvk::VertexAttributeLayout&  Layout,
+                            const float* const                  Source,
+                            const luvk::VertexDequantization&   Dequantization,
+                            std::byte* const                    Output) noexcept
+{
+    using luvk::VertexAttribute;
+    using luvk::VertexEncoding;
+
+    switch (Layout.Encoding)
+    {
+    case VertexEncoding::Float32:
+        std::memcpy(Output, Source, GetSourceComponents(Layout.Attribute) * sizeof(float));
+        break;
+
+    case VertexEncoding::Half:
+        if (Layout.Attribute == VertexAttribute::Position)
+        {
+            WriteComponents(Output,
+                            std::array{luvk::FloatToHalf(Source[0] - Dequantization.PositionOffset[0]),
+                                       luvk::FloatToHalf(Source[1] - Dequantization.PositionOffset[1]),
+                                       luvk::FloatToHalf(Source[2] - Dequantization.PositionOffset[2]),
+                                       g_HalfOne});
+        }
+        else if (Layout.Attribute == VertexAttribute::TexCoord)
+        {
+            WriteComponents(Output, std::array{luvk::FloatToHalf(Source[0]), luvk::FloatToHalf(Source[1])});
+        }
+        else
+        {
+            WriteComponents(Output, std::array{luvk::FloatToHalf(Source[0]), luvk::FloatToHalf(Source[1]), luvk::FloatToHalf(Source[2]), luvk::FloatToHalf(Source[3])});
+        }
+        break;
+
+    case VertexEncoding::Unorm16:
+        if (Layout.Attribute == VertexAttribute::Position)
+        {
+            auto Normalize = [&](const std::size_t Axis)
+            {
+                const float Scale = Dequantization.PositionScale[Axis];
+                return Scale > 0.F ? (Source[Axis] - Dequantization.PositionOffset[Axis]) / Scale : 0.F;
+            };
+
+            WriteComponents(Output,
+                            std::array{QuantizeUnorm<std::uint16_t>(Normalize(0U)),
+                                       QuantizeUnorm<std::uint16_t>(Normalize(1U)),
+                                       QuantizeUnorm<std::uint16_t>(Normalize(2U)),
+                                       std::numeric_limits<std::uint16_t>::max()});
+        }
+        else
+        {
+            auto Normalize = [&](const std::size_t Axis)
+            {
+                const float Scale = Dequantization.TexCoordOffsetScale[Axis + 2U];
+                return Scale > 0.F ? (Source[Axis] - Dequantization.TexCoordOffsetScale[Axis]) / Scale : 0.F;
+            };
+
+            WriteComponents(Output, std::array{QuantizeUnorm<std::uint16_t>(Normalize(0U)), QuantizeUnorm<std::uint16_t>(Normalize(1U))});
+        }
+        break;
+
+    case VertexEncoding::Unorm8:
+        WriteComponents(Output,
+                        std::array{QuantizeUnorm<std::uint8_t>(Source[0]),
+                                   QuantizeUnorm<std::uint8_t>(Source[1]),
+                                   QuantizeUnorm<std::uint8_t>(Source[2]),
+                                   QuantizeUnorm<std::uint8_t>(Source[3])});
+        break;
+
+    case VertexEncoding::Octahedral16:
+    case VertexEncoding::Octahedral8:
+    {
+        const std::array<float, 2> Encoded    = luvk::EncodeOctahedral({Source[0], Source[1], Source[2]});
+        const bool                 IsTangent  = Layout.Attribute == VertexAttribute::Tangent;
+        const float                Handedness = IsTangent && Source[3] < 0.F ? -1.F : 1.F;
+
+        if (Layout.Encoding == VertexEncoding::Octahedral16)
+        {
+            std::byte* const Next = WriteComponents(Output, std::array{QuantizeSnorm<std::int16_t>(Encoded[0]), QuantizeSnorm<std::int16_t>(Encoded[1])});
+
+            if (IsTangent)
+            {
+                WriteComponents(Next, std::array{std::int16_t{0}, QuantizeSnorm<std::int16_t>(Handedness)});
+            }
+        }
+        else
+        {
+            std::byte* const Next = WriteComponents(Output, std::array{QuantizeSnorm<std::int8_t>(Encoded[0]), QuantizeSnorm<std::int8_t>(Encoded[1])});
+
+            if (IsTangent)
+            {
+                WriteComponents(Next, std::array{std::int8_t{0}, QuantizeSnorm<std::int8_t>(Handedness)});
+            }
+        }
+        break;
+    }
+    }
+}
+
+VkFormat luvk::GetVertexFormat(const VertexAttribute Attribute, const VertexEncoding Encoding)
+{
+    const EncodingInfo Info = GetEncodingInfo(Attribute, Encoding);
+
+    if (Info.Format == VK_FORMAT_UNDEFINED)
+    {
+        throw std::runtime_error("Vertex encoding is not supported for this attribute.");
+    }
+
+    return Info.Format;
+}
+
+std::uint32_t luvk::GetVertexEncodingSize(const VertexAttribute Attribute, const VertexEncoding Encoding)
+{
+    const EncodingInfo Info = GetEncodingInfo(Attribute, Encoding);
+
+    if (Info.Format == VK_FORMAT_UNDEFINED)
+    {
+        throw std::runtime_error("Vertex encoding is not supported for this attribute.");
+    }
+
+    return Info.Size;
+}
+
+VkVertexInputBindingDescription luvk::GetVertexBindingDescription(const std::span<const VertexAttributeLayout> Attributes,
+                                                                  const std::uint32_t                          Binding,
+                                                                  const VkVertexInputRate                      InputRate)
+{
+    std::uint32_t Stride = 0U;
+
+    for (const VertexAttributeLayout& AttributeIt : Attributes)
+    {
+        Stride += AlignAttribute(GetVertexEncodingSize(AttributeIt.Attribute, AttributeIt.Encoding));
+    }
+
+    return {.binding = Binding, .stride = Stride, .inputRate = InputRate};
+}
+
+std::vector<VkVertexInputAttributeDescription> luvk::GetVertexAttributeDescriptions(const std::span<const VertexAttributeLayout> Attributes, const std::uint32_t Binding)
+{
+    std::vector<VkVertexInputAttributeDescription> Output{};
+    Output.reserve(std::size(Attributes));
+
+    std::uint32_t Offset = 0U;
+
+    for (const VertexAttributeLayout& AttributeIt : Attributes)
+    {
+        Output.push_back({.location = AttributeIt.Location,
+                          .binding = Binding,
+                          .format = GetVertexFormat(AttributeIt.Attribute, AttributeIt.Encoding),
+                          .offset = Offset});
+
+        Offset += AlignAttribute(GetVertexEncodingSize(AttributeIt.Attribute, AttributeIt.Encoding));
+    }
+
+    return Output;
+}
+
+luvk::CompressedVertices luvk::CompressVertices(const VertexCompressionArguments& Arguments)
+{
+    if (Arguments.VertexStride == 0U || Arguments.VertexStride % sizeof(float) != 0U)
+    {
+        throw std::runtime_error("Vertex compression requires a float vertex stride.");
+    }
+
+    for (const VertexAttributeLayout& AttributeIt : Arguments.Attributes)
+    {
+        if (AttributeIt.SourceOffset % sizeof(float) != 0U || AttributeIt.SourceOffset + GetSourceComponents(AttributeIt.Attribute) * sizeof(float) > Arguments.VertexStride)
+        {
+            throw std::runtime_error("Vertex attribute lies outside the source vertex.");
+        }
+    }
+
+    CompressedVertices Result{.VertexCount = static_cast<std::uint32_t>(std::size(Arguments.Vertices) / Arguments.VertexStride),
+                              .Binding = GetVertexBindingDescription(Arguments.Attributes, Arguments.Binding),
+                              .Attributes = GetVertexAttributeDescriptions(Arguments.Attributes, Arguments.Binding)};
+
+    std::vector<float> Source(std::size(Arguments.Vertices) / sizeof(float));
+    std::memcpy(std::data(Source), std::data(Arguments.Vertices), std::size(Source) * sizeof(float));
+
+    const std::uint32_t SourceStride = Arguments.VertexStride / sizeof(float);
+
+    auto ComputeBounds = [&](const VertexAttribute Attribute, const std::uint32_t Components, std::array<float, 3>& Minimum, std::array<float, 3>& Maximum)
+    {
+        const auto AttributeIt = std::ranges::find(Arguments.Attributes, Attribute, &VertexAttributeLayout::Attribute);
+
+        Minimum.fill(0.F);
+        Maximum.fill(0.F);
+
+        if (AttributeIt == std::end(Arguments.Attributes) || Result.VertexCount == 0U)
+        {
+            return false;
+        }
+
+        Minimum.fill(std::numeric_limits<float>::max());
+        Maximum.fill(std::numeric_limits<float>::lowest());
+
+        for (std::uint32_t Vertex = 0U; Vertex < Result.VertexCount; ++Vertex)
+        {
+            const float* const Values = &Source[static_cast<std::size_t>(Vertex) * SourceStride + AttributeIt->SourceOffset / sizeof(float)];
+
+            for (std::uint32_t Component = 0U; Component < Components; ++Component)
+            {
+                Minimum[Component] = std::min(Minimum[Component], Values[Component]);
+                Maximum[Component] = std::max(Maximum[Component], Values[Component]);
+            }
+        }
+
+        return true;
+    };
+
+    if (std::array<float, 3> Minimum{}, Maximum{};
+        ComputeBounds(VertexAttribute::Position, 3U, Minimum, Maximum))
+    {
+        const auto PositionIt = std::ranges::find(Arguments.Attributes, VertexAttribute::Position, &VertexAttributeLayout::Attribute);
+
+        for (std::size_t Axis = 0U; Axis < 3U; ++Axis)
+        {
+            if (PositionIt->Encoding == VertexEncoding::Half)
+            {
+                Result.Dequantization.PositionOffset[Axis] = (Minimum[Axis] + Maximum[Axis]) * 0.5F;
+            }
+            else if (PositionIt->Encoding == VertexEncoding::Unorm16)
+            {
+                Result.Dequantization.PositionOffset[Axis] = Minimum[Axis];
+                Result.Dequantization.PositionScale[Axis]  = Maximum[Axis] - Minimum[Axis];
+            }
+        }
+    }
+
+    if (std::array<float, 3> Minimum{}, Maximum{};
+        ComputeBounds(VertexAttribute::TexCoord, 2U, Minimum, Maximum) &&
+        std::ranges::find(Arguments.Attributes, VertexAttribute::TexCoord, &VertexAttributeLayout::Attribute)->Encoding == VertexEncoding::Unorm16)
+    {
+        Result.Dequantization.TexCoordOffsetScale = {Minimum[0], Minimum[1], Maximum[0] - Minimum[0], Maximum[1] - Minimum[1]};
+    }
+
+    Result.Data.resize(static_cast<std::size_t>(Result.VertexCount) * Result.Binding.stride);
+
+    for (std::uint32_t Vertex = 0U; Vertex < Result.VertexCount; ++Vertex)
+    {
+        const float* const Input  = &Source[static_cast<std::size_t>(Vertex) * SourceStride];
+        std::byte* const   Output = &Result.Data[static_cast<std::size_t>(Vertex) * Result.Binding.stride];
+
+        for (std::size_t Attribute = 0U; Attribute < std::size(Arguments.Attributes); ++Attribute)
+        {
+            const VertexAttributeLayout& Layout = Arguments.Attributes[Attribute];
+            EncodeAttribute(Layout, Input + Layout.SourceOffset / sizeof(float), Result.Dequantization, Output + Result.Attributes[Attribute].offset);
+        }
+    }
+
+    return Result;
+}
+
+std::uint16_t luvk::FloatToHalf(const float Value) noexcept
+{
+    const auto          Bits     = std::bit_cast<std::uint32_t>(Value);
+    const auto          Sign     = static_cast<std::uint16_t>(Bits >> 16U & 0x8000U);
+    const std::uint32_t Absolute = Bits & 0x7FFFFFFFU;
+
+    if (Absolute >= 0x7F800000U)
+    {
+        return static_cast<std::uint16_t>(Sign | (Absolute > 0x7F800000U ? 0x7E00U : 0x7C00U));
+    }
+
+    if (Absolute >= 0x477FF000U)
+    {
+        return static_cast<std::uint16_t>(Sign | 0x7C00U);
+    }
+
+    if (Absolute < 0x38800000U)
+    {
+        const float Denormal = std::bit_cast<float>(Absolute) + 0.5F;
+        return static_cast<std::uint16_t>(Sign | (std::bit_cast<std::uint32_t>(Denormal) - 0x3F000000U));
+    }
+
+    const std::uint32_t Rounded = Absolute + 0xC8000FFFU + (Absolute >> 13U & 1U);
+    return static_cast<std::uint16_t>(Sign | Rounded >> 13U);
+}
+
+float luvk::HalfToFloat(const std::uint16_t Value) noexcept
+{
+    const std::uint32_t Sign     = static_cast<std::uint32_t>(Value & 0x8000U) << 16U;
+    const std::uint32_t Exponent = Value >> 10U & 0x1FU;
+    const std::uint32_t Mantissa = Value & 0x3FFU;
+
+    if (Exponent == 0U)
+    {
+        const float Denormal = static_cast<float>(Mantissa) * 5.9604644775390625E-8F;
+        return Sign != 0U ? -Denormal : Denormal;
+    }
+
+    if (Exponent == 0x1FU)
+    {
+        return std::bit_cast<float>(Sign | 0x7F800000U | Mantissa << 13U);
+    }
+
+    return std::bit_cast<float>(Sign | (Exponent + 112U) << 23U | Mantissa << 13U);
+}
+
+std::array<float, 2> luvk::EncodeOctahedral(const std::array<float, 3>& Direction) noexcept
+{
+    const float Length = std::abs(Direction[0]) + std::abs(Direction[1]) + std::abs(Direction[2]);
+
+    if (Length <= 0.F)
+    {
+        return {0.F, 0.F};
+    }
+
+    float X = Direction[0] / Length;
+    float Y = Direction[1] / Length;
+
+    if (Direction[2] < 0.F)
+    {
+        const float FoldedX = (1.F - std::abs(Y)) * (X >= 0.F ? 1.F : -1.F);
+        const float FoldedY = (1.F - std::abs(X)) * (Y >= 0.F ? 1.F : -1.F);
+
+        X = FoldedX;
+        Y = FoldedY;
+    }
+
+    return {X, Y};
+}
+
+std::array<float, 3> luvk::DecodeOctahedral(const std::array<float, 2>& Encoded) noexcept
+{
+    float       X = Encoded[0];
+    float       Y = Encoded[1];
+    const float Z = 1.F - std::abs(X) - std::abs(Y);
+
+    if (Z < 0.F)
+    {
+        const float FoldedX = (1.F - std::abs(Y)) * (X >= 0.F ? 1.F : -1.F);
+        const float FoldedY = (1.F - std::abs(X)) * (Y >= 0.F ? 1.F : -1.F);
+
+        X = FoldedX;
+        Y = FoldedY;
+    }
+
+    const float Length = std::sqrt(X * X + Y * Y + Z * Z);
+    return {X / Length, Y / Length, Z / Length};
+}
@@ -0,0 +1,448 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/DepthPyramid.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+#include "luvk/Libraries/ShaderCompiler.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/Draw.hpp"
+#include "luvk/Modules/SwapChain.hpp"
+#include "luvk/Resources/Buffer.hpp"
+#include "luvk/Resources/DescriptorSet.hpp"
+#include "luvk/Resources/Image.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Resources/Sampler.hpp"
+#include "luvk/Shaders/DepthPyramid.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
+
+constexpr auto g_PyramidTileSize = 32U;
+constexpr auto g_MaxPyramidSize  = 1U << (luvk::DepthPyramid::MaxMipCount - 1U);
+
+struct PyramidParameters
+{
+    std::array<std::uint32_t, 2> SourceSize{};
+    std::array<std::uint32_t, 2> PyramidSize{};
+    std::array<float, 2>         SourceScale{};
+    std::uint32_t                MipCount{0};
+    std::uint32_t                GroupCount{0};
+    std::uint32_t                ReverseDepth{0};
+};
+
+constexpr std::array g_PyramidBindings{VkDescriptorSetLayoutBinding{.binding = 0,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 1,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 2,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                                                                    .descriptorCount = luvk::DepthPyramid::MaxMipCount,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT}};
+
+luvk::DepthPyramid::DepthPyramid(const std::shared_ptr<Device>&         DeviceModule,
+                                 const std::shared_ptr<Memory>&         MemoryModule,
+                                 const std::shared_ptr<DescriptorPool>& PoolModule,
+                                 const std::shared_ptr<SwapChain>&      SwapChainModule,
+                                 const std::shared_ptr<Draw>&           DrawModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule),
+      m_PoolModule(PoolModule),
+      m_SwapChainModule(SwapChainModule),
+      m_DrawModule(DrawModule) {}
+
+void luvk::DepthPyramid::CreatePyramid(const CreationArguments& Arguments)
+{
+    if (!m_SwapChainModule->KeepsDepth())
+    {
+        throw std::runtime_error("Depth pyramid requires a swapchain created with KeepDepth.");
+    }
+
+    std::vector<std::uint32_t> ShaderCode(std::begin(Arguments.Shader), std::end(Arguments.Shader));
+
+#ifdef LUVK_SLANG_INCLUDED
+    if (std::empty(ShaderCode))
+    {
+        ShaderCode = CompileShader(Shaders::DepthPyramid);
+    }
+#endif
+
+    if (std::empty(ShaderCode))
+    {
+        throw std::runtime_error("Depth pyramid requires the reduction shader SPIR-V.");
+    }
+
+    ClearResources();
+
+    m_ReverseDepth = Arguments.ReverseDepth;
+    m_ReadbackSize = Arguments.ReadbackSize;
+
+    m_Sampler = std::make_shared<Sampler>(m_DeviceModule);
+    m_Sampler->CreateSampler({.Filter = VK_FILTER_NEAREST,
+                              .AddressMode = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                              .MipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST});
+
+    m_Counter = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    m_Counter->CreateBuffer({.Size = sizeof(std::uint32_t),
+                             .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                             .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                             .Name = "Depth Pyramid Counter"});
+
+    const std::shared_ptr<DescriptorSet>& LayoutOwner = m_Sets.front();
+
+    for (std::uint32_t Index = 0U; Index < Constants::ImageCount; ++Index)
+    {
+        std::shared_ptr<DescriptorSet>& Set = m_Sets.at(Index);
+        Set                                 = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+
+        if (Index == 0U)
+        {
+            Set->CreateLayout({.Bindings = g_PyramidBindings});
+        }
+        else
+        {
+            Set->UseLayout(LayoutOwner->GetLayout(), g_PyramidBindings);
+        }
+
+        Set->Allocate();
+        Set->UpdateBuffer(m_Counter->GetHandle(), m_Counter->GetSize(), 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    }
+
+    CreateTargets();
+
+    constexpr VkPushConstantRange PushConstants{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(PyramidParameters)};
+    const VkDescriptorSetLayout   SetLayout = LayoutOwner->GetLayout();
+
+    m_Pipeline = std::make_shared<Pipeline>(m_DeviceModule);
+    m_Pipeline->CreateComputePipeline({.ComputeShader = ShaderCode,
+                                       .SetLayouts = std::span(&SetLayout, 1U),
+                                       .PushConstants = std::span(&PushConstants, 1U)});
+}
+
+void luvk::DepthPyramid::CreateTargets()
+{
+    const VkExtent2D    SourceExtent = m_SwapChainModule->GetExtent();
+    const std::uint32_t Width        = std::min(std::bit_floor(std::max(SourceExtent.width, 1U)), g_MaxPyramidSize);
+    const std::uint32_t Height       = std::min(std::bit_floor(std::max(SourceExtent.height, 1U)), g_MaxPyramidSize);
+    const std::uint32_t MipCount     = static_cast<std::uint32_t>(std::bit_width(std::max(Width, Height)));
+
+    m_Pyramid = std::make_shared<Image>(m_DeviceModule, m_MemoryModule);
+    m_Pyramid->CreateImage({.Extent = {Width, Height, 1},
+                            .Format = VK_FORMAT_R32_SFLOAT,
+                            .Usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                            .Aspect = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                            .MipLevels = MipCount,
+                            .CreateMipViews = true});
+
+    m_ReadbackLevel = 0U;
+
+    while (m_ReadbackLevel + 1U < MipCount && std::max(Width >> m_ReadbackLevel, Height >> m_ReadbackLevel) > m_ReadbackSize)
+    {
+        ++m_ReadbackLevel;
+    }
+
+    m_ReadbackExtent = {std::max(Width >> m_ReadbackLevel, 1U), std::max(Height >> m_ReadbackLevel, 1U)};
+
+    for (Readback& ReadbackIt : m_Readbacks)
+    {
+        ReadbackIt      = {};
+        ReadbackIt.Data = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        ReadbackIt.Data->CreateBuffer({.Size = sizeof(float) * m_ReadbackExtent.width * m_ReadbackExtent.height,
+                                       .Usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                       .MemoryUsage = VMA_MEMORY_USAGE_GPU_TO_CPU,
+                                       .Name = "Depth Pyramid Readback"});
+    }
+
+    for (std::uint32_t Index = 0U; Index < Constants::ImageCount; ++Index)
+    {
+        const std::shared_ptr<DescriptorSet>& Set        = m_Sets.at(Index);
+        const std::shared_ptr<Image>          DepthImage = m_SwapChainModule->GetDepthImage(Index);
+
+        Set->UpdateImage(DepthImage->GetView(), VK_NULL_HANDLE, 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
+
+        for (std::uint32_t Level = 0U; Level < MaxMipCount; ++Level)
+        {
+            Set->UpdateImage(m_Pyramid->GetMipView(std::min(Level, MipCount - 1U)),
+                             VK_NULL_HANDLE,
+                             2,
+                             VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                             VK_IMAGE_LAYOUT_GENERAL,
+                             Level);
+        }
+
+        m_SourceImages.at(Index) = DepthImage;
+    }
+
+    m_SourceExtent = SourceExtent;
+    m_Initialized  = false;
+    m_HostPyramid.clear();
+}
+
+bool luvk::DepthPyramid::IsSourceOutdated() const noexcept
+{
+    const VkExtent2D SourceExtent = m_SwapChainModule->GetExtent();
+
+    if (SourceExtent.width != m_SourceExtent.width || SourceExtent.height != m_SourceExtent.height)
+    {
+        return true;
+    }
+
+    for (std::uint32_t Index = 0U; Index < Constants::ImageCount; ++Index)
+    {
+        if (m_SourceImages.at(Index).lock() != m_SwapChainModule->GetDepthImage(Index))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void luvk::DepthPyramid::RecordPyramid(CommandRecorder& Recorder)
+{
+    if (!m_Pipeline)
+    {
+        return;
+    }
+
+    if (IsSourceOutdated())
+    {
+        m_DeviceModule->WaitIdle();
+        CreateTargets();
+    }
+
+    const VkImage       Pyramid  = m_Pyramid->GetHandle();
+    const std::uint32_t MipCount = m_Pyramid->GetMipLevels();
+
+    if (!m_Initialized)
+    {
+        const VkImageMemoryBarrier ToGeneral{.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                             .srcAccessMask = 0,
+                                             .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                                             .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                                             .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                                             .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                             .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                             .image = Pyramid,
+                                             .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, MipCount, 0, 1}};
+
+        vkCmdPipelineBarrier(Recorder,
+                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0,
+                             0,
+                             nullptr,
+                             0,
+                             nullptr,
+                             1,
+                             &ToGeneral);
+
+        m_Initialized = true;
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_SHADER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+
+    vkCmdFillBuffer(Recorder, m_Counter->GetHandle(), 0, VK_WHOLE_SIZE, 0U);
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+    const VkExtent2D       SourceExtent  = m_SwapChainModule->GetExtent();
+    const VkExtent2D       PyramidExtent = m_Pyramid->GetExtent();
+    const std::uint32_t    GroupsX       = (PyramidExtent.width + g_PyramidTileSize - 1U) / g_PyramidTileSize;
+    const std::uint32_t    GroupsY       = (PyramidExtent.height + g_PyramidTileSize - 1U) / g_PyramidTileSize;
+    const VkPipelineLayout Layout        = m_Pipeline->GetPipelineLayout();
+
+    const PyramidParameters Parameters{.SourceSize = {SourceExtent.width, SourceExtent.height},
+                                       .PyramidSize = {PyramidExtent.width, PyramidExtent.height},
+                                       .SourceScale = {static_cast<float>(SourceExtent.width) / static_cast<float>(PyramidExtent.width),
+                                                       static_cast<float>(SourceExtent.height) / static_cast<float>(PyramidExtent.height)},
+                                       .MipCount = MipCount,
+                                       .GroupCount = GroupsX * GroupsY,
+                                       .ReverseDepth = m_ReverseDepth ? 1U : 0U};
+
+    const std::shared_ptr<DescriptorSet>& Set = m_Sets.at(m_DrawModule->GetCurrentImageIndex());
+    Set->Flush();
+
+    Recorder.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, m_Pipeline->GetPipeline(), Layout);
+    Recorder.BindDescriptorSet(VK_PIPELINE_BIND_POINT_COMPUTE, Layout, 0, Set->GetHandle());
+    Recorder.PushConstants(Layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, std::as_bytes(std::span(&Parameters, 1U)));
+
+    vkCmdDispatch(Recorder, GroupsX, GroupsY, 1U);
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT);
+
+    Readback& Target = m_Readbacks.at(m_FrameIndex);
+
+    const VkBufferImageCopy Region{.bufferOffset = 0,
+                                   .bufferRowLength = 0,
+                                   .bufferImageHeight = 0,
+                                   .imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, m_ReadbackLevel, 0, 1},
+                                   .imageOffset = {0, 0, 0},
+                                   .imageExtent = {m_ReadbackExtent.width, m_ReadbackExtent.height, 1}};
+
+    vkCmdCopyImageToBuffer(Recorder, Pyramid, VK_IMAGE_LAYOUT_GENERAL, Target.Data->GetHandle(), 1, &Region);
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_HOST_BIT,
+                             VK_ACCESS_HOST_READ_BIT);
+
+    Target.Pending        = true;
+    Target.ViewProjection = m_ViewProjections.at(m_FrameIndex);
+}
+
+void luvk::DepthPyramid::SetViewProjection(const std::array<float, 16>& ViewProjection)
+{
+    m_ViewProjections.at(m_FrameIndex) = ViewProjection;
+}
+
+void luvk::DepthPyramid::BeginFrame(const std::uint32_t FrameIndex)
+{
+    m_FrameIndex = FrameIndex;
+
+    Readback& Source = m_Readbacks.at(FrameIndex);
+
+    if (!Source.Pending || !Source.Data)
+    {
+        return;
+    }
+
+    m_HostPyramid.resize(std::size_t{m_ReadbackExtent.width} * m_ReadbackExtent.height);
+    Source.Data->Download(std::as_writable_bytes(std::span(m_HostPyramid)));
+
+    m_HostViewProjection = Source.ViewProjection;
+    Source.Pending       = false;
+}
+
+bool luvk::DepthPyramid::IsVisible(const InstanceCulling::InstanceBounds& Bounds) const noexcept
+{
+    if (std::empty(m_HostPyramid))
+    {
+        return true;
+    }
+
+    const std::array<float, 3>& Extents = Bounds.Shape == InstanceCulling::BoundsShape::Sphere
+                                              ? std::array{Bounds.Radius, Bounds.Radius, Bounds.Radius}
+                                              : Bounds.Extents;
+
+    const std::array<float, 16>& Matrix = m_HostViewProjection;
+
+    float MinX    = 1.F;
+    float MinY    = 1.F;
+    float MaxX    = 0.F;
+    float MaxY    = 0.F;
+    float Nearest = m_ReverseDepth ? 0.F : 1.F;
+
+    for (std::uint32_t Corner = 0U; Corner < 8U; ++Corner)
+    {
+        const float X = Bounds.Center.at(0U) + ((Corner & 1U) != 0U ? Extents.at(0U) : -Extents.at(0U));
+        const float Y = Bounds.Center.at(1U) + ((Corner & 2U) != 0U ? Extents.at(1U) : -Extents.at(1U));
+        const float Z = Bounds.Center.at(2U) + ((Corner & 4U) != 0U ? Extents.at(2U) : -Extents.at(2U));
+
+        const float ClipX = Matrix.at(0U) * X + Matrix.at(4U) * Y + Matrix.at(8U) * Z + Matrix.at(12U);
+        const float ClipY = Matrix.at(1U) * X + Matrix.at(5U) * Y + Matrix.at(9U) * Z + Matrix.at(13U);
+        const float ClipZ = Matrix.at(2U) * X + Matrix.at(6U) * Y + Matrix.at(10U) * Z + Matrix.at(14U);
+        const float ClipW = Matrix.at(3U) * X + Matrix.at(7U) * Y + Matrix.at(11U) * Z + Matrix.at(15U);
+
+        if (ClipW <= 1e-5F)
+        {
+            return true;
+        }
+
+        const float U     = ClipX / ClipW * 0.5F + 0.5F;
+        const float V     = ClipY / ClipW * 0.5F + 0.5F;
+        const float Depth = ClipZ / ClipW;
+
+        MinX    = std::min(MinX, U);
+        MinY    = std::min(MinY, V);
+        MaxX    = std::max(MaxX, U);
+        MaxY    = std::max(MaxY, V);
+        Nearest = m_ReverseDepth ? std::max(Nearest, Depth) : std::min(Nearest, Depth);
+    }
+
+    if (MaxX < 0.F || MaxY < 0.F || MinX > 1.F || MinY > 1.F)
+    {
+        return true;
+    }
+
+    const auto Width  = static_cast<float>(m_ReadbackExtent.width);
+    const auto Height = static_cast<float>(m_ReadbackExtent.height);
+
+    const auto FirstX = static_cast<std::uint32_t>(std::floor(std::clamp(MinX, 0.F, 1.F) * Width));
+    const auto FirstY = static_cast<std::uint32_t>(std::floor(std::clamp(MinY, 0.F, 1.F) * Height));
+    const auto LastX  = std::min(static_cast<std::uint32_t>(std::floor(std::clamp(MaxX, 0.F, 1.F) * Width)), m_ReadbackExtent.width - 1U);
+    const auto LastY  = std::min(static_cast<std::uint32_t>(std::floor(std::clamp(MaxY, 0.F, 1.F) * Height)), m_ReadbackExtent.height - 1U);
+
+    float Farthest = m_ReverseDepth ? 1.F : 0.F;
+
+    for (std::uint32_t Row = std::min(FirstY, LastY); Row <= LastY; ++Row)
+    {
+        for (std::uint32_t Column = std::min(FirstX, LastX); Column <= LastX; ++Column)
+        {
+            const float Sample = m_HostPyramid.at(std::size_t{Row} * m_ReadbackExtent.width + Column);
+            Farthest           = m_ReverseDepth ? std::min(Farthest, Sample) : std::max(Farthest, Sample);
+        }
+    }
+
+    return m_ReverseDepth ? Nearest >= Farthest : Nearest <= Farthest;
+}
+
+luvk::InstanceCulling::DepthPyramidInfo luvk::DepthPyramid::GetPyramidInfo() const noexcept
+{
+    if (!m_Initialized || !m_Pyramid)
+    {
+        return {};
+    }
+
+    return {.View = m_Pyramid->GetView(),
+            .Sampler = m_Sampler->GetHandle(),
+            .Layout = VK_IMAGE_LAYOUT_GENERAL,
+            .Extent = m_Pyramid->GetExtent(),
+            .MipCount = m_Pyramid->GetMipLevels(),
+            .ReverseDepth = m_ReverseDepth};
+}
+
+void luvk::DepthPyramid::ClearResources()
+{
+    m_Pipeline.reset();
+
+    for (std::shared_ptr<DescriptorSet>& SetIt : m_Sets)
+    {
+        SetIt.reset();
+    }
+
+    for (Readback& ReadbackIt : m_Readbacks)
+    {
+        ReadbackIt = {};
+    }
+
+    m_Counter.reset();
+    m_Sampler.reset();
+    m_Pyramid.reset();
+    m_HostPyramid.clear();
+
+    for (std::weak_ptr<Image>& SourceIt : m_SourceImages)
+    {
+        SourceIt.reset();
+    }
+
+    m_Initialized    = false;
+    m_ReadbackLevel  = 0U;
+    m_ReadbackExtent = {0U, 0U};
+    m_SourceExtent   = {0U, 0U};
+}
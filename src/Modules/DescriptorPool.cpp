@@ -3,11 +3,32 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Modules/DescriptorPool.hpp"
+#include <algorithm>
 #include <iterator>
 #include <stdexcept>
 #include "luvk/Libraries/VulkanHelpers.hpp"
 #include "luvk/Modules/Device.hpp"
 
+constexpr auto g_MaxSetsPerPage = 4096U;
+
+static VkResult AllocateFromPool(const VkDevice              LogicalDevice,
+                                 const VkDescriptorPool      Pool,
+                                 const VkDescriptorSetLayout Layout,
+                                 VkDescriptorSet* const      Set)
+{
+    const VkDescriptorSetAllocateInfo AllocateInfo{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+                                                   .descriptorPool = Pool,
+                                                   .descriptorSetCount = 1,
+                                                   .pSetLayouts = &Layout};
+
+    return vkAllocateDescriptorSets(LogicalDevice, &AllocateInfo, Set);
+}
+
+static constexpr bool IsPoolExhausted(const VkResult Result)
+{
+    return Result == VK_ERROR_OUT_OF_POOL_MEMORY || Result == VK_ERROR_FRAGMENTED_POOL;
+}
+
 luvk::DescriptorPool::DescriptorPool(const std::shared_ptr<Device>& DeviceModule)
     : m_DeviceModule(DeviceModule) {}
 
@@ -15,23 +36,171 @@ void luvk::DescriptorPool::CreateDescriptorPool(const std::uint32_t
                                                 const std::span<const VkDescriptorPoolSize> PoolSizes,
                                                 const VkDescriptorPoolCreateFlags           Flags)
 {
-    const VkDescriptorPoolCreateInfo Info{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-                                          .flags = Flags,
-                                          .maxSets = MaxSets,
-                                          .poolSizeCount = static_cast<std::uint32_t>(std::size(PoolSizes)),
-                                          .pPoolSizes = std::data(PoolSizes)};
+    std::lock_guard Lock(m_Mutex);
+
+    m_MaxSets     = std::max(MaxSets, 1U);
+    m_NextMaxSets = m_MaxSets;
+    m_Flags       = Flags;
+    m_PoolSizes.assign(std::begin(PoolSizes), std::end(PoolSizes));
+
+    m_Pools.push_back(CreatePage(m_NextMaxSets, m_Flags));
+}
+
+VkDescriptorPool luvk::DescriptorPool::Allocate(const VkDescriptorSetLayout Layout, VkDescriptorSet& Set)
+{
+    std::lock_guard Lock(m_Mutex);
 
-    if (!LUVK_EXECUTE(vkCreateDescriptorPool(m_DeviceModule->GetLogicalDevice(), &Info, nullptr, &m_Pool)))
+    if (m_MaxSets == 0U)
     {
-        throw std::runtime_error("Failed to create descriptor pool.");
+        throw std::runtime_error("Descriptor pool was not created.");
+    }
+
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    for (auto PoolIt = std::rbegin(m_Pools); PoolIt != std::rend(m_Pools); ++PoolIt)
+    {
+        const VkResult Result = AllocateFromPool(LogicalDevice, *PoolIt, Layout, &Set);
+
+        if (Result == VK_SUCCESS)
+        {
+            return *PoolIt;
+        }
+
+        if (!IsPoolExhausted(Result))
+        {
+            LUVK_EXECUTE(Result);
+            throw std::runtime_error("Failed to allocate descriptor set.");
+        }
+
+        if (!CanFreeSets())
+        {
+            break;
+        }
+    }
+
+    m_NextMaxSets = std::max(m_MaxSets, std::min(m_NextMaxSets * 2U, g_MaxSetsPerPage));
+    m_Pools.push_back(CreatePage(m_NextMaxSets, m_Flags));
+
+    if (!LUVK_EXECUTE(AllocateFromPool(LogicalDevice, m_Pools.back(), Layout, &Set)))
+    {
+        throw std::runtime_error("Failed to allocate descriptor set.");
+    }
+
+    return m_Pools.back();
+}
+
+VkDescriptorSet luvk::DescriptorPool::AllocateTransient(const VkDescriptorSetLayout Layout, const std::uint32_t FrameIndex)
+{
+    std::lock_guard Lock(m_Mutex);
+
+    if (m_MaxSets == 0U)
+    {
+        throw std::runtime_error("Descriptor pool was not created.");
+    }
+
+    const VkDevice  LogicalDevice = m_DeviceModule->GetLogicalDevice();
+    TransientPages& Pages         = m_TransientPools.at(FrameIndex);
+    VkDescriptorSet Set{VK_NULL_HANDLE};
+
+    while (true)
+    {
+        const bool FreshPage = Pages.Current == std::size(Pages.Pools);
+
+        if (FreshPage)
+        {
+            Pages.Pools.push_back(CreatePage(m_MaxSets, m_Flags & ~VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT));
+        }
+
+        const VkResult Result = AllocateFromPool(LogicalDevice, Pages.Pools.at(Pages.Current), Layout, &Set);
+
+        if (Result == VK_SUCCESS)
+        {
+            return Set;
+        }
+
+        if (FreshPage || !IsPoolExhausted(Result))
+        {
+            LUVK_EXECUTE(Result);
+            throw std::runtime_error("Failed to allocate transient descriptor set.");
+        }
+
+        ++Pages.Current;
+    }
+}
+
+void luvk::DescriptorPool::Free(const VkDescriptorPool Pool, const VkDescriptorSet Set)
+{
+    if (Pool == VK_NULL_HANDLE || Set == VK_NULL_HANDLE || !CanFreeSets())
+    {
+        return;
+    }
+
+    std::lock_guard Lock(m_Mutex);
+    vkFreeDescriptorSets(m_DeviceModule->GetLogicalDevice(), Pool, 1, &Set);
+}
+
+void luvk::DescriptorPool::ResetTransient(const std::uint32_t FrameIndex)
+{
+    std::lock_guard Lock(m_Mutex);
+
+    const VkDevice  LogicalDevice = m_DeviceModule->GetLogicalDevice();
+    TransientPages& Pages         = m_TransientPools.at(FrameIndex);
+
+    const std::size_t UsedPages = std::min(Pages.Current + 1U, std::size(Pages.Pools));
+    for (std::size_t Index = 0U; Index < UsedPages; ++Index)
+    {
+        vkResetDescriptorPool(LogicalDevice, Pages.Pools.at(Index), 0);
     }
+
+    Pages.Current = 0U;
 }
 
 void luvk::DescriptorPool::ClearResources()
 {
-    if (m_Pool != VK_NULL_HANDLE)
+    std::lock_guard Lock(m_Mutex);
+
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    for (TransientPages& PagesIt : m_TransientPools)
+    {
+        for (const VkDescriptorPool PoolIt : PagesIt.Pools)
+        {
+            vkDestroyDescriptorPool(LogicalDevice, PoolIt, nullptr);
+        }
+
+        PagesIt.Pools.clear();
+        PagesIt.Current = 0U;
+    }
+
+    for (const VkDescriptorPool PoolIt : m_Pools)
+    {
+        vkDestroyDescriptorPool(LogicalDevice, PoolIt, nullptr);
+    }
+
+    m_Pools.clear();
+}
+
+VkDescriptorPool luvk::DescriptorPool::CreatePage(const std::uint32_t MaxSets, const VkDescriptorPoolCreateFlags Flags) const
+{
+    std::vector<VkDescriptorPoolSize> Sizes = m_PoolSizes;
+
+    for (VkDescriptorPoolSize& SizeIt : Sizes)
+    {
+        const std::uint64_t Scaled = static_cast<std::uint64_t>(SizeIt.descriptorCount) * MaxSets;
+        SizeIt.descriptorCount     = std::max(1U, static_cast<std::uint32_t>((Scaled + m_MaxSets - 1U) / m_MaxSets));
+    }
+
+    const VkDescriptorPoolCreateInfo Info{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+                                          .flags = Flags,
+                                          .maxSets = MaxSets,
+                                          .poolSizeCount = static_cast<std::uint32_t>(std::size(Sizes)),
+                                          .pPoolSizes = std::data(Sizes)};
+
+    VkDescriptorPool Pool{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreateDescriptorPool(m_DeviceModule->GetLogicalDevice(), &Info, nullptr, &Pool)))
     {
-        vkDestroyDescriptorPool(m_DeviceModule->GetLogicalDevice(), m_Pool, nullptr);
-        m_Pool = VK_NULL_HANDLE;
+        throw std::runtime_error("Failed to create descriptor pool.");
     }
+
+    return Pool;
 }
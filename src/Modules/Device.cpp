@@ -8,6 +8,7 @@
 #include <stdexcept>
 #include "luvk/Interfaces/IExtensionsModule.hpp"
 #include "luvk/Libraries/VulkanHelpers.hpp"
+#include "luvk/Modules/Memory.hpp"
 #include "luvk/Modules/Renderer.hpp"
 
 luvk::Device::Device(const std::shared_ptr<Renderer>& RendererModule)
@@ -26,13 +27,38 @@ void luvk::Device::SetPhysicalDevice(const VkPhysicalDevice Device)
     m_Vulkan13Features     = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES};
     m_Vulkan14Features     = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES};
 
-    m_DeviceFeatures.pNext   = &m_Vulkan11Features;
-    m_Vulkan11Features.pNext = &m_Vulkan12Features;
-    m_Vulkan12Features.pNext = &m_Vulkan13Features;
-    m_Vulkan13Features.pNext = &m_Vulkan14Features;
+    m_BufferDeviceAddressFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES};
 
-    if (m_RendererModule->GetInstanceCreationArguments().VulkanApiVersion > VK_API_VERSION_1_0 ||
-        m_Extensions.HasAvailableExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
+    vkGetPhysicalDeviceProperties(m_PhysicalDevice, &m_DeviceProperties);
+
+    const std::uint32_t ApiVersion = GetEffectiveApiVersion();
+
+    auto LinkFeatures = [this](auto& Features)
+    {
+        Features.pNext         = m_DeviceFeatures.pNext;
+        m_DeviceFeatures.pNext = &Features;
+    };
+
+    if (ApiVersion >= VK_API_VERSION_1_4)
+    {
+        LinkFeatures(m_Vulkan14Features);
+    }
+
+    if (ApiVersion >= VK_API_VERSION_1_3)
+    {
+        LinkFeatures(m_Vulkan13Features);
+    }
+
+    if (ApiVersion >= VK_API_VERSION_1_2)
+    {
+        LinkFeatures(m_Vulkan12Features);
+        LinkFeatures(m_Vulkan11Features);
+    }
+
+    const bool HasFeatures2 = m_RendererModule->GetInstanceCreationArguments().VulkanApiVersion > VK_API_VERSION_1_0 ||
+                              m_Extensions.HasAvailableExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    if (HasFeatures2)
     {
         vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &m_DeviceFeatures);
     }
@@ -41,7 +67,16 @@ void luvk::Device::SetPhysicalDevice(const VkPhysicalDevice Device)
         vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &m_DeviceFeatures.features);
     }
 
-    vkGetPhysicalDeviceProperties(m_PhysicalDevice, &m_DeviceProperties);
+    if (HasFeatures2 &&
+        ApiVersion < VK_API_VERSION_1_2 &&
+        m_Extensions.HasAvailableExtension(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME))
+    {
+        VkPhysicalDeviceFeatures2 AddressQuery{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, .pNext = &m_BufferDeviceAddressFeatures};
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &AddressQuery);
+
+        m_BufferDeviceAddressFeatures.bufferDeviceAddressCaptureReplay = VK_FALSE;
+        m_BufferDeviceAddressFeatures.bufferDeviceAddressMultiDevice   = VK_FALSE;
+    }
 
     std::uint32_t NumProperties = 0U;
     vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &NumProperties, nullptr);
@@ -166,6 +201,16 @@ const void* luvk::Device::ConfigureExtensions(const void* pNext)
     const void*          FeatureChain = pNext;
     const RenderModules& Modules      = m_RendererModule->GetModules();
 
+    if (GetEffectiveApiVersion() < VK_API_VERSION_1_2 &&
+        m_BufferDeviceAddressFeatures.bufferDeviceAddress == VK_TRUE &&
+        !HasFeatureStructure(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES))
+    {
+        m_Extensions.SetExtensionState("", VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME, true);
+
+        m_BufferDeviceAddressFeatures.pNext = m_DeviceFeatures.pNext;
+        m_DeviceFeatures.pNext              = &m_BufferDeviceAddressFeatures;
+    }
+
     auto ProcessModule = [&](const std::shared_ptr<IRenderModule>& Module)
     {
         if (Module == nullptr)
@@ -207,6 +252,7 @@ const void* luvk::Device::ConfigureExtensions(const void* pNext)
     };
 
     ProcessModule(Modules.DeviceModule);
+    ProcessModule(Modules.MemoryModule);
     ProcessModule(Modules.SynchronizationModule);
 
     for (const std::shared_ptr<IRenderModule>& ModuleIt : Modules.ExtraModules)
@@ -231,6 +277,64 @@ void luvk::Device::FetchAvailableDevices(const VkInstance Instance)
     vkEnumeratePhysicalDevices(Instance, &NumDevices, std::data(m_AvailableDevices));
 }
 
+bool luvk::Device::HasFeatureStructure(const VkStructureType Type) const noexcept
+{
+    for (auto Base = static_cast<const VkBaseInStructure*>(m_DeviceFeatures.pNext); Base != nullptr; Base = Base->pNext)
+    {
+        if (Base->sType == Type)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint32_t luvk::Device::GetEffectiveApiVersion() const noexcept
+{
+    return std::min(m_RendererModule->GetInstanceCreationArguments().VulkanApiVersion, m_DeviceProperties.apiVersion);
+}
+
+bool luvk::Device::SupportsPushDescriptors() const noexcept
+{
+    if (GetEffectiveApiVersion() >= VK_API_VERSION_1_4 && m_Vulkan14Features.pushDescriptor == VK_TRUE)
+    {
+        return true;
+    }
+
+    return m_Extensions.IsExtensionEnabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+}
+
+bool luvk::Device::SupportsBufferDeviceAddress() const noexcept
+{
+    if (GetEffectiveApiVersion() >= VK_API_VERSION_1_2)
+    {
+        return m_Vulkan12Features.bufferDeviceAddress == VK_TRUE;
+    }
+
+    return m_BufferDeviceAddressFeatures.bufferDeviceAddress == VK_TRUE && m_Extensions.IsExtensionEnabled(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+}
+
+bool luvk::Device::SupportsDrawIndirectCount() const noexcept
+{
+    if (GetEffectiveApiVersion() >= VK_API_VERSION_1_2)
+    {
+        return m_Vulkan12Features.drawIndirectCount == VK_TRUE;
+    }
+
+    return m_Extensions.IsExtensionEnabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+}
+
+bool luvk::Device::SupportsPipelineCreationFeedback() const noexcept
+{
+    if (GetEffectiveApiVersion() >= VK_API_VERSION_1_3)
+    {
+        return true;
+    }
+
+    return m_Extensions.IsExtensionEnabled(VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME);
+}
+
 std::optional<std::uint32_t> luvk::Device::FindQueueFamilyIndex(const VkQueueFlags Flags) const
 {
     for (std::uint32_t Index = 0U; Index < std::size(m_DeviceQueueFamilyProperties); ++Index)
@@ -281,3 +385,67 @@ void luvk::Device::Wait(const VkFence Fence, const VkBool32 WaitAll, const std::
         vkWaitForFences(m_LogicalDevice, 1, &Fence, WaitAll, Timeout);
     }
 }
+
+void luvk::Device::SubmitImmediate(const std::function<void(VkCommandBuffer)>& Record) const
+{
+    const std::uint32_t QueueFamily = FindQueueFamilyIndex(VK_QUEUE_GRAPHICS_BIT).value();
+    const VkQueue       Queue       = GetQueue(QueueFamily);
+
+    const VkCommandPoolCreateInfo PoolInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                           .pNext = nullptr,
+                                           .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                           .queueFamilyIndex = QueueFamily};
+
+    VkCommandPool Pool{VK_NULL_HANDLE};
+
+    if (!LUVK_EXECUTE(vkCreateCommandPool(m_LogicalDevice, &PoolInfo, nullptr, &Pool)))
+    {
+        throw std::runtime_error("Failed to create command pool for immediate submission");
+    }
+
+    const VkCommandBufferAllocateInfo AllocationInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                                     .pNext = nullptr,
+                                                     .commandPool = Pool,
+                                                     .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                                                     .commandBufferCount = 1};
+
+    VkCommandBuffer CommandBuffer{VK_NULL_HANDLE};
+
+    if (!LUVK_EXECUTE(vkAllocateCommandBuffers(m_LogicalDevice, &AllocationInfo, &CommandBuffer)))
+    {
+        vkDestroyCommandPool(m_LogicalDevice, Pool, nullptr);
+        throw std::runtime_error("Failed to allocate command buffer for immediate submission");
+    }
+
+    constexpr VkCommandBufferBeginInfo CommandBufferBeginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                              .pNext = nullptr,
+                                                              .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                              .pInheritanceInfo = nullptr};
+    vkBeginCommandBuffer(CommandBuffer, &CommandBufferBeginInfo);
+
+    Record(CommandBuffer);
+
+    vkEndCommandBuffer(CommandBuffer);
+
+    const VkSubmitInfo QueueSubmitInfo{.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                       .pNext = nullptr,
+                                       .waitSemaphoreCount = 0,
+                                       .pWaitSemaphores = nullptr,
+                                       .pWaitDstStageMask = nullptr,
+                                       .commandBufferCount = 1,
+                                       .pCommandBuffers = &CommandBuffer,
+                                       .signalSemaphoreCount = 0,
+                                       .pSignalSemaphores = nullptr};
+
+    if (!LUVK_EXECUTE(vkQueueSubmit(Queue, 1, &QueueSubmitInfo, VK_NULL_HANDLE)))
+    {
+        vkFreeCommandBuffers(m_LogicalDevice, Pool, 1, &CommandBuffer);
+        vkDestroyCommandPool(m_LogicalDevice, Pool, nullptr);
+        throw std::runtime_error("Failed to submit immediate command");
+    }
+
+    vkQueueWaitIdle(Queue);
+
+    vkFreeCommandBuffers(m_LogicalDevice, Pool, 1, &CommandBuffer);
+    vkDestroyCommandPool(m_LogicalDevice, Pool, nullptr);
+}
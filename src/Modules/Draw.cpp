@@ -23,10 +23,14 @@ void luvk::Draw::RecordCommands(const FrameData& Frame, const std::uint32_t Imag
 
     LUVK_EXECUTE(vkBeginCommandBuffer(Frame.CommandBuffer, &Begin));
 
+    m_CurrentImageIndex = ImageIndex;
+
+    CommandRecorder Recorder(Frame.CommandBuffer);
+
     std::erase_if(m_PreRenderCallbacks,
                   [&](const DrawCallbackInfo& CB)
                   {
-                      return !CB.Callback(Frame.CommandBuffer);
+                      return !CB.Callback(Recorder);
                   });
 
     const VkRenderPass  RenderPass  = m_SwapChainModule->GetRenderPass();
@@ -45,22 +49,29 @@ void luvk::Draw::RecordCommands(const FrameData& Frame, const std::uint32_t Imag
     const VkViewport Viewport{0.F, 0.F, static_cast<float>(Extent.width), static_cast<float>(Extent.height), 0.F, 1.F};
     const VkRect2D   Scissor{{0, 0}, Extent};
 
-    vkCmdSetViewport(Frame.CommandBuffer, 0U, 1U, &Viewport);
-    vkCmdSetScissor(Frame.CommandBuffer, 0U, 1U, &Scissor);
+    Recorder.SetViewport(Viewport);
+    Recorder.SetScissor(Scissor);
 
     std::erase_if(m_DrawCallbacks,
                   [&](const DrawCallbackInfo& CB)
                   {
-                      return !CB.Callback(Frame.CommandBuffer);
+                      return !CB.Callback(Recorder);
                   });
 
     std::erase_if(m_PostRenderCallbacks,
                   [&](const DrawCallbackInfo& CB)
                   {
-                      return !CB.Callback(Frame.CommandBuffer);
+                      return !CB.Callback(Recorder);
                   });
 
     vkCmdEndRenderPass(Frame.CommandBuffer);
+
+    std::erase_if(m_PostPassCallbacks,
+                  [&](const DrawCallbackInfo& CB)
+                  {
+                      return !CB.Callback(Recorder);
+                  });
+
     LUVK_EXECUTE(vkEndCommandBuffer(Frame.CommandBuffer));
 }
 
@@ -0,0 +1,406 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/FrustumCulling.hpp"
+#include <bit>
+#include <cmath>
+#include "luvk/Modules/ThreadPool.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LUVK_CULLING_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LUVK_CULLING_SSE
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LUVK_CULLING_NEON
+#endif
+
+namespace
+{
+    struct PreparedPlane
+    {
+        float NormalX;
+        float NormalY;
+        float NormalZ;
+        float Distance;
+        float AbsX;
+        float AbsY;
+        float AbsZ;
+    };
+
+    using PreparedPlanes = std::array<PreparedPlane, 6>;
+
+    struct BoundsView
+    {
+        const float* CenterX;
+        const float* CenterY;
+        const float* CenterZ;
+        const float* Radius;
+        const float* ExtentX;
+        const float* ExtentY;
+        const float* ExtentZ;
+    };
+
+    PreparedPlanes PreparePlanes(const luvk::FrustumCulling::Planes& Frustum) noexcept
+    {
+        PreparedPlanes Output{};
+
+        for (std::size_t Index = 0U; Index < std::size(Frustum); ++Index)
+        {
+            const std::array<float, 4>& Plane = Frustum.at(Index);
+
+            Output.at(Index) = PreparedPlane{.NormalX = Plane.at(0U),
+                                             .NormalY = Plane.at(1U),
+                                             .NormalZ = Plane.at(2U),
+                                             .Distance = Plane.at(3U),
+                                             .AbsX = std::abs(Plane.at(0U)),
+                                             .AbsY = std::abs(Plane.at(1U)),
+                                             .AbsZ = std::abs(Plane.at(2U))};
+        }
+
+        return Output;
+    }
+
+    bool TestObject(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        for (const PreparedPlane& PlaneIt : Frustum)
+        {
+            const float Distance = PlaneIt.NormalX * Bounds.CenterX[Index] +
+                                   PlaneIt.NormalY * Bounds.CenterY[Index] +
+                                   PlaneIt.NormalZ * Bounds.CenterZ[Index] +
+                                   PlaneIt.Distance;
+
+            const float Reach = Bounds.Radius[Index] +
+                                PlaneIt.AbsX * Bounds.ExtentX[Index] +
+                                PlaneIt.AbsY * Bounds.ExtentY[Index] +
+                                PlaneIt.AbsZ * Bounds.ExtentZ[Index];
+
+            if (Distance + Reach < 0.F)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+#if defined(LUVK_CULLING_AVX2)
+    constexpr auto g_PackTable = []
+    {
+        std::array<std::uint64_t, 256U> Table{};
+
+        for (std::uint32_t Mask = 0U; Mask < 256U; ++Mask)
+        {
+            std::uint32_t Slot = 0U;
+
+            for (std::uint32_t Lane = 0U; Lane < 8U; ++Lane)
+            {
+                if ((Mask >> Lane & 1U) != 0U)
+                {
+                    Table.at(Mask) |= std::uint64_t{Lane} << Slot++ * 8U;
+                }
+            }
+        }
+
+        return Table;
+    }();
+
+    std::uint32_t PackBlock(const std::uint32_t Mask, const std::uint32_t Index, std::uint32_t* const Output) noexcept
+    {
+        const __m256i Lanes = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(g_PackTable[Mask])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Output), _mm256_add_epi32(Lanes, _mm256_set1_epi32(static_cast<int>(Index))));
+        return static_cast<std::uint32_t>(std::popcount(Mask));
+    }
+
+    std::uint32_t TestBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        const __m256 CenterX = _mm256_loadu_ps(Bounds.CenterX + Index);
+        const __m256 CenterY = _mm256_loadu_ps(Bounds.CenterY + Index);
+        const __m256 CenterZ = _mm256_loadu_ps(Bounds.CenterZ + Index);
+        const __m256 Radius  = _mm256_loadu_ps(Bounds.Radius + Index);
+        const __m256 ExtentX = _mm256_loadu_ps(Bounds.ExtentX + Index);
+        const __m256 ExtentY = _mm256_loadu_ps(Bounds.ExtentY + Index);
+        const __m256 ExtentZ = _mm256_loadu_ps(Bounds.ExtentZ + Index);
+        const __m256 Zero    = _mm256_setzero_ps();
+
+        __m256 Mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+        for (const PreparedPlane& PlaneIt : Frustum)
+        {
+            const __m256 Distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(PlaneIt.NormalX), CenterX),
+                                                                _mm256_mul_ps(_mm256_set1_ps(PlaneIt.NormalY), CenterY)),
+                                                  _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(PlaneIt.NormalZ), CenterZ),
+                                                                _mm256_set1_ps(PlaneIt.Distance)));
+
+            const __m256 Reach = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(PlaneIt.AbsX), ExtentX),
+                                                             _mm256_mul_ps(_mm256_set1_ps(PlaneIt.AbsY), ExtentY)),
+                                               _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(PlaneIt.AbsZ), ExtentZ), Radius));
+
+            Mask = _mm256_and_ps(Mask, _mm256_cmp_ps(_mm256_add_ps(Distance, Reach), Zero, _CMP_GE_OQ));
+        }
+
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(Mask));
+    }
+#elif defined(LUVK_CULLING_SSE)
+    std::uint32_t TestHalfBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        const __m128 CenterX = _mm_loadu_ps(Bounds.CenterX + Index);
+        const __m128 CenterY = _mm_loadu_ps(Bounds.CenterY + Index);
+        const __m128 CenterZ = _mm_loadu_ps(Bounds.CenterZ + Index);
+        const __m128 Radius  = _mm_loadu_ps(Bounds.Radius + Index);
+        const __m128 ExtentX = _mm_loadu_ps(Bounds.ExtentX + Index);
+        const __m128 ExtentY = _mm_loadu_ps(Bounds.ExtentY + Index);
+        const __m128 ExtentZ = _mm_loadu_ps(Bounds.ExtentZ + Index);
+        const __m128 Zero    = _mm_setzero_ps();
+
+        __m128 Mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+        for (const PreparedPlane& PlaneIt : Frustum)
+        {
+            const __m128 Distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(PlaneIt.NormalX), CenterX),
+                                                          _mm_mul_ps(_mm_set1_ps(PlaneIt.NormalY), CenterY)),
+                                               _mm_add_ps(_mm_mul_ps(_mm_set1_ps(PlaneIt.NormalZ), CenterZ),
+                                                          _mm_set1_ps(PlaneIt.Distance)));
+
+            const __m128 Reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(PlaneIt.AbsX), ExtentX),
+                                                       _mm_mul_ps(_mm_set1_ps(PlaneIt.AbsY), ExtentY)),
+                                            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(PlaneIt.AbsZ), ExtentZ), Radius));
+
+            Mask = _mm_and_ps(Mask, _mm_cmpge_ps(_mm_add_ps(Distance, Reach), Zero));
+        }
+
+        return static_cast<std::uint32_t>(_mm_movemask_ps(Mask));
+    }
+
+    std::uint32_t TestBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        return TestHalfBlock(Frustum, Bounds, Index) | TestHalfBlock(Frustum, Bounds, Index + 4U) << 4U;
+    }
+#elif defined(LUVK_CULLING_NEON)
+    std::uint32_t TestHalfBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        const float32x4_t CenterX = vld1q_f32(Bounds.CenterX + Index);
+        const float32x4_t CenterY = vld1q_f32(Bounds.CenterY + Index);
+        const float32x4_t CenterZ = vld1q_f32(Bounds.CenterZ + Index);
+        const float32x4_t Radius  = vld1q_f32(Bounds.Radius + Index);
+        const float32x4_t ExtentX = vld1q_f32(Bounds.ExtentX + Index);
+        const float32x4_t ExtentY = vld1q_f32(Bounds.ExtentY + Index);
+        const float32x4_t ExtentZ = vld1q_f32(Bounds.ExtentZ + Index);
+
+        uint32x4_t Mask = vdupq_n_u32(0xFFFFFFFFU);
+
+        for (const PreparedPlane& PlaneIt : Frustum)
+        {
+            float32x4_t Distance = vdupq_n_f32(PlaneIt.Distance);
+            Distance             = vmlaq_n_f32(Distance, CenterX, PlaneIt.NormalX);
+            Distance             = vmlaq_n_f32(Distance, CenterY, PlaneIt.NormalY);
+            Distance             = vmlaq_n_f32(Distance, CenterZ, PlaneIt.NormalZ);
+
+            float32x4_t Reach = Radius;
+            Reach             = vmlaq_n_f32(Reach, ExtentX, PlaneIt.AbsX);
+            Reach             = vmlaq_n_f32(Reach, ExtentY, PlaneIt.AbsY);
+            Reach             = vmlaq_n_f32(Reach, ExtentZ, PlaneIt.AbsZ);
+
+            Mask = vandq_u32(Mask, vcgeq_f32(vaddq_f32(Distance, Reach), vdupq_n_f32(0.F)));
+        }
+
+        constexpr std::uint32_t Weights[4]{1U, 2U, 4U, 8U};
+        return vaddvq_u32(vandq_u32(Mask, vld1q_u32(Weights)));
+    }
+
+    std::uint32_t TestBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        return TestHalfBlock(Frustum, Bounds, Index) | TestHalfBlock(Frustum, Bounds, Index + 4U) << 4U;
+    }
+#else
+    std::uint32_t TestBlock(const PreparedPlanes& Frustum, const BoundsView& Bounds, const std::uint32_t Index) noexcept
+    {
+        std::uint32_t Mask = 0U;
+
+        for (std::uint32_t Lane = 0U; Lane < luvk::FrustumCulling::BlockSize; ++Lane)
+        {
+            Mask |= static_cast<std::uint32_t>(TestObject(Frustum, Bounds, Index + Lane)) << Lane;
+        }
+
+        return Mask;
+    }
+#endif
+
+#if !defined(LUVK_CULLING_AVX2)
+    std::uint32_t PackBlock(const std::uint32_t Mask, const std::uint32_t Index, std::uint32_t* const Output) noexcept
+    {
+        std::uint32_t Written = 0U;
+
+        for (std::uint32_t Lane = 0U; Lane < luvk::FrustumCulling::BlockSize; ++Lane)
+        {
+            Output[Written] = Index + Lane;
+            Written += Mask >> Lane & 1U;
+        }
+
+        return Written;
+    }
+#endif
+} // namespace
+
+luvk::FrustumCulling::FrustumCulling(const std::shared_ptr<ThreadPool>& ThreadPoolModule)
+    : m_ThreadPoolModule(ThreadPoolModule) {}
+
+void luvk::FrustumCulling::Reserve(const std::size_t Count)
+{
+    for (std::vector<float>* ArrayIt : {&m_CenterX, &m_CenterY, &m_CenterZ, &m_Radius, &m_ExtentX, &m_ExtentY, &m_ExtentZ})
+    {
+        ArrayIt->reserve(Count);
+    }
+
+    m_Visible.reserve(Count);
+}
+
+void luvk::FrustumCulling::Clear() noexcept
+{
+    for (std::vector<float>* ArrayIt : {&m_CenterX, &m_CenterY, &m_CenterZ, &m_Radius, &m_ExtentX, &m_ExtentY, &m_ExtentZ})
+    {
+        ArrayIt->clear();
+    }
+
+    m_VisibleCount = 0U;
+}
+
+std::uint32_t luvk::FrustumCulling::AddSphere(const std::array<float, 3>& Center, const float Radius)
+{
+    const auto Index = static_cast<std::uint32_t>(GetCount());
+
+    m_CenterX.push_back(Center.at(0U));
+    m_CenterY.push_back(Center.at(1U));
+    m_CenterZ.push_back(Center.at(2U));
+    m_Radius.push_back(Radius);
+    m_ExtentX.push_back(0.F);
+    m_ExtentY.push_back(0.F);
+    m_ExtentZ.push_back(0.F);
+
+    return Index;
+}
+
+std::uint32_t luvk::FrustumCulling::AddBox(const std::array<float, 3>& Center, const std::array<float, 3>& Extents)
+{
+    const std::uint32_t Index = AddSphere(Center, 0.F);
+    SetBox(Index, Center, Extents);
+    return Index;
+}
+
+void luvk::FrustumCulling::SetSphere(const std::uint32_t Index, const std::array<float, 3>& Center, const float Radius)
+{
+    m_CenterX.at(Index) = Center.at(0U);
+    m_CenterY.at(Index) = Center.at(1U);
+    m_CenterZ.at(Index) = Center.at(2U);
+    m_Radius.at(Index)  = Radius;
+    m_ExtentX.at(Index) = 0.F;
+    m_ExtentY.at(Index) = 0.F;
+    m_ExtentZ.at(Index) = 0.F;
+}
+
+void luvk::FrustumCulling::SetBox(const std::uint32_t Index, const std::array<float, 3>& Center, const std::array<float, 3>& Extents)
+{
+    m_CenterX.at(Index) = Center.at(0U);
+    m_CenterY.at(Index) = Center.at(1U);
+    m_CenterZ.at(Index) = Center.at(2U);
+    m_Radius.at(Index)  = 0.F;
+    m_ExtentX.at(Index) = Extents.at(0U);
+    m_ExtentY.at(Index) = Extents.at(1U);
+    m_ExtentZ.at(Index) = Extents.at(2U);
+}
+
+std::span<const std::uint32_t> luvk::FrustumCulling::Cull(const Planes& Frustum)
+{
+    const auto Count = static_cast<std::uint32_t>(GetCount());
+
+    if (std::size(m_Visible) < Count)
+    {
+        m_Visible.resize(Count);
+    }
+
+    m_VisibleCount = 0U;
+
+    if (Count == 0U)
+    {
+        return GetVisible();
+    }
+
+    const std::uint32_t Chunk = GetParallelChunk(m_ThreadPoolModule.get(), Count, m_MinObjectsPerTask, BlockSize);
+    const std::size_t   Tasks = (Count + Chunk - 1U) / Chunk;
+
+    m_TaskCounts.assign(Tasks, 0U);
+    std::uint32_t* const Output = std::data(m_Visible);
+
+    ParallelFor(m_ThreadPoolModule.get(),
+                Count,
+                Chunk,
+                [&](const std::uint32_t Begin, const std::uint32_t End)
+                {
+                    m_TaskCounts.at(Begin / Chunk) = CullRange(Frustum, Begin, End, Output + Begin);
+                });
+
+    for (std::size_t Task = 0U; Task < Tasks; ++Task)
+    {
+        const std::uint32_t* const Source = Output + Task * Chunk;
+        std::copy_n(Source, m_TaskCounts.at(Task), Output + m_VisibleCount);
+        m_VisibleCount += m_TaskCounts.at(Task);
+    }
+
+    return GetVisible();
+}
+
+std::string_view luvk::FrustumCulling::GetBackendName() noexcept
+{
+#if defined(LUVK_CULLING_AVX2)
+    return "AVX2";
+#elif defined(LUVK_CULLING_SSE)
+    return "SSE2";
+#elif defined(LUVK_CULLING_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+void luvk::FrustumCulling::ClearResources()
+{
+    Clear();
+    m_Visible.clear();
+    m_TaskCounts.clear();
+}
+
+std::uint32_t luvk::FrustumCulling::CullRange(const Planes&       Frustum,
+                                              const std::uint32_t Begin,
+                                              const std::uint32_t End,
+                                              std::uint32_t*      Output) const noexcept
+{
+    const PreparedPlanes Prepared = PreparePlanes(Frustum);
+    const BoundsView     Bounds{.CenterX = std::data(m_CenterX),
+                                .CenterY = std::data(m_CenterY),
+                                .CenterZ = std::data(m_CenterZ),
+                                .Radius = std::data(m_Radius),
+                                .ExtentX = std::data(m_ExtentX),
+                                .ExtentY = std::data(m_ExtentY),
+                                .ExtentZ = std::data(m_ExtentZ)};
+
+    std::uint32_t Written = 0U;
+    std::uint32_t Index   = Begin;
+
+    for (; Index + BlockSize <= End; Index += BlockSize)
+    {
+        Written += PackBlock(TestBlock(Prepared, Bounds, Index), Index, Output + Written);
+    }
+
+    for (; Index < End; ++Index)
+    {
+        if (TestObject(Prepared, Bounds, Index))
+        {
+            Output[Written++] = Index;
+        }
+    }
+
+    return Written;
+}
@@ -0,0 +1,367 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/IndirectDraw.hpp"
+#include <array>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "luvk/Libraries/ShaderCompiler.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/UniformArena.hpp"
+#include "luvk/Resources/Buffer.hpp"
+#include "luvk/Resources/DescriptorSet.hpp"
+#include "luvk/Resources/GeometryBuffer.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Shaders/DrawCompaction.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
+#include "luvk/Types/Material.hpp"
+
+static_assert(sizeof(luvk::IndirectDraw::DrawRecord) == 32U);
+
+constexpr auto g_CompactionGroupSize = 64U;
+constexpr auto g_UnusedSlot         = std::numeric_limits<std::uint32_t>::max();
+
+struct CompactionParameters
+{
+    std::uint32_t RecordCount{0};
+    std::uint32_t FixedSlots{0};
+};
+
+luvk::IndirectDraw::IndirectDraw(const std::shared_ptr<Device>&         DeviceModule,
+                                 const std::shared_ptr<Memory>&         MemoryModule,
+                                 const std::shared_ptr<DescriptorPool>& PoolModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule),
+      m_PoolModule(PoolModule) {}
+
+std::uint32_t luvk::IndirectDraw::AddBucket(const BucketInfo& Info)
+{
+    if (m_CompactionPipeline)
+    {
+        throw std::runtime_error("Indirect draw buckets must be added before creation.");
+    }
+
+    if (!Info.MaterialObj || !Info.Geometry || Info.MaxDraws == 0U)
+    {
+        throw std::runtime_error("Invalid indirect draw bucket.");
+    }
+
+    m_BucketOffsets.push_back(m_TotalDraws);
+    m_Buckets.push_back(Info);
+    m_TotalDraws += Info.MaxDraws;
+
+    return static_cast<std::uint32_t>(std::size(m_Buckets) - 1U);
+}
+
+void luvk::IndirectDraw::CreateIndirectDraw(const CreationArguments& Arguments)
+{
+    if (std::empty(m_Buckets) || Arguments.MaxRecords == 0U)
+    {
+        throw std::runtime_error("Indirect draw requires at least one bucket and record.");
+    }
+
+    std::vector<std::uint32_t> ShaderCode(std::begin(Arguments.CompactionShader), std::end(Arguments.CompactionShader));
+
+#ifdef LUVK_SLANG_INCLUDED
+    if (std::empty(ShaderCode))
+    {
+        ShaderCode = CompileShader(Shaders::DrawCompaction);
+    }
+#endif
+
+    if (std::empty(ShaderCode))
+    {
+        throw std::runtime_error("Indirect draw requires the compaction shader SPIR-V.");
+    }
+
+    const VkPhysicalDeviceFeatures& Features = m_DeviceModule->GetDeviceFeatures().features;
+
+    m_MaxRecords        = Arguments.MaxRecords;
+    m_FirstInstance     = Features.drawIndirectFirstInstance == VK_TRUE;
+    m_UseDrawCount      = m_FirstInstance && m_DeviceModule->SupportsDrawIndirectCount();
+    m_MultiDrawIndirect = Features.multiDrawIndirect == VK_TRUE;
+
+    if (!m_FirstInstance)
+    {
+        for (const BucketInfo& BucketIt : m_Buckets)
+        {
+            if (BucketIt.InstanceBuffer && BucketIt.InstanceStride == 0U)
+            {
+                throw std::runtime_error("Indirect draw buckets require an instance stride without drawIndirectFirstInstance.");
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> BucketData{};
+    BucketData.reserve(std::size(m_Buckets) * 2U);
+
+    for (std::size_t Index = 0U; Index < std::size(m_Buckets); ++Index)
+    {
+        BucketData.push_back(m_BucketOffsets.at(Index));
+        BucketData.push_back(m_Buckets.at(Index).MaxDraws);
+    }
+
+    m_BucketBuffer = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    m_BucketBuffer->CreateBuffer({.Size = std::size(BucketData) * sizeof(std::uint32_t),
+                                  .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                  .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                  .Name = "Indirect Buckets"});
+    m_BucketBuffer->Upload(std::as_bytes(std::span(BucketData)));
+
+    constexpr std::array Bindings{VkDescriptorSetLayoutBinding{.binding = 0,
+                                                               .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                               .descriptorCount = 1,
+                                                               .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                  VkDescriptorSetLayoutBinding{.binding = 1,
+                                                               .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                               .descriptorCount = 1,
+                                                               .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                  VkDescriptorSetLayoutBinding{.binding = 2,
+                                                               .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                               .descriptorCount = 1,
+                                                               .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                  VkDescriptorSetLayoutBinding{.binding = 3,
+                                                               .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                               .descriptorCount = 1,
+                                                               .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT}};
+
+    for (std::uint32_t Frame = 0U; Frame < Constants::ImageCount; ++Frame)
+    {
+        FrameResources& Resources = m_Frames.at(Frame);
+
+        Resources.Records = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        Resources.Records->CreateBuffer({.Size = sizeof(DrawRecord) * m_MaxRecords,
+                                         .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                         .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                         .Name = "Indirect Records"});
+
+        Resources.Commands = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        Resources.Commands->CreateBuffer({.Size = sizeof(VkDrawIndexedIndirectCommand) * m_TotalDraws,
+                                          .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                   VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                                   VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                          .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                          .Name = "Indirect Commands"});
+
+        Resources.Counts = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        Resources.Counts->CreateBuffer({.Size = sizeof(std::uint32_t) * std::size(m_Buckets),
+                                        .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                                 VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                        .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                        .Name = "Indirect Counts"});
+
+        Resources.Set = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+
+        if (Frame == 0U)
+        {
+            Resources.Set->CreateLayout({.Bindings = Bindings});
+        }
+        else
+        {
+            Resources.Set->UseLayout(m_Frames.front().Set->GetLayout(), Bindings);
+        }
+
+        Resources.Set->Allocate();
+        Resources.Set->UpdateBuffer(Resources.Records->GetHandle(), Resources.Records->GetSize(), 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Resources.Set->UpdateBuffer(Resources.Commands->GetHandle(), Resources.Commands->GetSize(), 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Resources.Set->UpdateBuffer(Resources.Counts->GetHandle(), Resources.Counts->GetSize(), 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Resources.Set->UpdateBuffer(m_BucketBuffer->GetHandle(), m_BucketBuffer->GetSize(), 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Resources.Set->Flush();
+    }
+
+    constexpr VkPushConstantRange PushConstants{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(CompactionParameters)};
+    const VkDescriptorSetLayout   SetLayout = m_Frames.front().Set->GetLayout();
+
+    m_CompactionPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+    m_CompactionPipeline->CreateComputePipeline({.ComputeShader = ShaderCode,
+                                                 .SetLayouts = std::span(&SetLayout, 1U),
+                                                 .PushConstants = std::span(&PushConstants, 1U)});
+}
+
+void luvk::IndirectDraw::SetRecords(const std::span<const DrawRecord> Records, const std::uint32_t FrameIndex)
+{
+    if (std::size(Records) > m_MaxRecords)
+    {
+        throw std::runtime_error("Indirect draw record count exceeds capacity.");
+    }
+
+    FrameResources& Resources = m_Frames.at(FrameIndex);
+
+    Resources.RecordCount = static_cast<std::uint32_t>(std::size(Records));
+
+    if (m_FirstInstance)
+    {
+        Resources.Records->Upload(std::as_bytes(Records));
+        return;
+    }
+
+    std::vector<DrawRecord>    SlottedRecords(std::begin(Records), std::end(Records));
+    std::vector<std::uint32_t> BucketCounts(std::size(m_Buckets), 0U);
+
+    Resources.SlotInstances.assign(m_TotalDraws, g_UnusedSlot);
+
+    for (DrawRecord& RecordIt : SlottedRecords)
+    {
+        if (RecordIt.Bucket >= std::size(m_Buckets) || BucketCounts.at(RecordIt.Bucket) >= m_Buckets.at(RecordIt.Bucket).MaxDraws)
+        {
+            RecordIt.Visible = 0U;
+            continue;
+        }
+
+        RecordIt.Reserved0 = BucketCounts.at(RecordIt.Bucket)++;
+        Resources.SlotInstances.at(m_BucketOffsets.at(RecordIt.Bucket) + RecordIt.Reserved0) = RecordIt.InstanceIndex;
+    }
+
+    Resources.Records->Upload(std::as_bytes(std::span(SlottedRecords)));
+}
+
+void luvk::IndirectDraw::RecordCompaction(CommandRecorder& Recorder) const
+{
+    if (!m_CompactionPipeline)
+    {
+        return;
+    }
+
+    const FrameResources& Resources = m_Frames.at(m_FrameIndex);
+
+    vkCmdFillBuffer(Recorder, Resources.Counts->GetHandle(), 0, VK_WHOLE_SIZE, 0U);
+
+    if (!m_UseDrawCount)
+    {
+        vkCmdFillBuffer(Recorder, Resources.Commands->GetHandle(), 0, VK_WHOLE_SIZE, 0U);
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+    if (Resources.RecordCount > 0U)
+    {
+        const VkPipelineLayout     Layout = m_CompactionPipeline->GetPipelineLayout();
+        const CompactionParameters Parameters{.RecordCount = Resources.RecordCount, .FixedSlots = m_FirstInstance ? 0U : 1U};
+
+        Recorder.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, m_CompactionPipeline->GetPipeline(), Layout);
+        Recorder.BindDescriptorSet(VK_PIPELINE_BIND_POINT_COMPUTE, Layout, 0, Resources.Set->GetHandle());
+        Recorder.PushConstants(Layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, std::as_bytes(std::span(&Parameters, 1U)));
+
+        vkCmdDispatch(Recorder, (Resources.RecordCount + g_CompactionGroupSize - 1U) / g_CompactionGroupSize, 1U, 1U);
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                             VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+}
+
+void luvk::IndirectDraw::RecordDraws(CommandRecorder& Recorder) const
+{
+    if (!m_CompactionPipeline)
+    {
+        return;
+    }
+
+    const FrameResources& Resources = m_Frames.at(m_FrameIndex);
+
+    const auto DrawIndirectCount = m_DeviceModule->GetEffectiveApiVersion() >= VK_API_VERSION_1_2
+                                       ? vkCmdDrawIndexedIndirectCount
+                                       : vkCmdDrawIndexedIndirectCountKHR;
+
+    constexpr std::uint32_t ZeroOffset = 0U;
+
+    for (std::size_t Index = 0U; Index < std::size(m_Buckets); ++Index)
+    {
+        const BucketInfo& Bucket = m_Buckets.at(Index);
+
+        Bucket.MaterialObj->Bind(Recorder,
+                                 m_FrameIndex,
+                                 Bucket.MaterialObj->GetUniformArena() ? std::span(&ZeroOffset, 1U) : std::span<const std::uint32_t>{});
+
+        std::array<VkBuffer, 2U>     VtxBuffers{Bucket.Geometry->GetVertexBuffer()->GetHandle(), VK_NULL_HANDLE};
+        std::array<VkDeviceSize, 2U> Offsets{};
+        std::uint32_t                NumBuffers = 1U;
+
+        if (Bucket.InstanceBuffer)
+        {
+            VtxBuffers.at(NumBuffers++) = Bucket.InstanceBuffer->GetHandle();
+        }
+
+        Recorder.BindVertexBuffers(0, std::span(std::data(VtxBuffers), NumBuffers), std::span(std::data(Offsets), NumBuffers));
+        Recorder.BindIndexBuffer(Bucket.Geometry->GetIndexBuffer()->GetHandle(), 0, VK_INDEX_TYPE_UINT32);
+
+        const VkDeviceSize CommandOffset = m_BucketOffsets.at(Index) * sizeof(VkDrawIndexedIndirectCommand);
+
+        if (m_UseDrawCount)
+        {
+            DrawIndirectCount(Recorder,
+                              Resources.Commands->GetHandle(),
+                              CommandOffset,
+                              Resources.Counts->GetHandle(),
+                              Index * sizeof(std::uint32_t),
+                              Bucket.MaxDraws,
+                              sizeof(VkDrawIndexedIndirectCommand));
+            continue;
+        }
+
+        if (!m_FirstInstance)
+        {
+            for (std::uint32_t Slot = 0U; Slot < Bucket.MaxDraws; ++Slot)
+            {
+                const std::uint32_t InstanceIndex = std::empty(Resources.SlotInstances)
+                                                        ? g_UnusedSlot
+                                                        : Resources.SlotInstances.at(m_BucketOffsets.at(Index) + Slot);
+
+                if (InstanceIndex == g_UnusedSlot)
+                {
+                    continue;
+                }
+
+                if (Bucket.InstanceBuffer)
+                {
+                    const VkBuffer     InstanceBuffer = Bucket.InstanceBuffer->GetHandle();
+                    const VkDeviceSize InstanceOffset = static_cast<VkDeviceSize>(InstanceIndex) * Bucket.InstanceStride;
+
+                    Recorder.BindVertexBuffers(1, std::span(&InstanceBuffer, 1U), std::span(&InstanceOffset, 1U));
+                }
+
+                vkCmdDrawIndexedIndirect(Recorder,
+                                         Resources.Commands->GetHandle(),
+                                         CommandOffset + Slot * sizeof(VkDrawIndexedIndirectCommand),
+                                         1U,
+                                         sizeof(VkDrawIndexedIndirectCommand));
+            }
+            continue;
+        }
+
+        const std::uint32_t DrawsPerCall = m_MultiDrawIndirect ? Bucket.MaxDraws : 1U;
+
+        for (std::uint32_t FirstDraw = 0U; FirstDraw < Bucket.MaxDraws; FirstDraw += DrawsPerCall)
+        {
+            vkCmdDrawIndexedIndirect(Recorder,
+                                     Resources.Commands->GetHandle(),
+                                     CommandOffset + FirstDraw * sizeof(VkDrawIndexedIndirectCommand),
+                                     DrawsPerCall,
+                                     sizeof(VkDrawIndexedIndirectCommand));
+        }
+    }
+}
+
+void luvk::IndirectDraw::ClearResources()
+{
+    m_CompactionPipeline.reset();
+
+    for (FrameResources& FrameIt : m_Frames)
+    {
+        FrameIt = {};
+    }
+
+    m_BucketBuffer.reset();
+    m_Buckets.clear();
+    m_BucketOffsets.clear();
+    m_TotalDraws = 0U;
+    m_MaxRecords = 0U;
+}
@@ -0,0 +1,402 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/InstanceCulling.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include "luvk/Libraries/ShaderCompiler.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Resources/Buffer.hpp"
+#include "luvk/Resources/DescriptorSet.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Shaders/InstanceCulling.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
+
+static_assert(sizeof(luvk::InstanceCulling::InstanceBounds) == 32U);
+static_assert(sizeof(luvk::InstanceCulling::ViewInfo) == 160U);
+
+constexpr auto g_CullingGroupSize = 64U;
+
+struct CullingParameters
+{
+    std::uint32_t InstanceCount{0};
+    std::uint32_t InstanceStride{0};
+    std::uint32_t PyramidMips{0};
+    float         PyramidWidth{0.F};
+    float         PyramidHeight{0.F};
+    std::uint32_t ReverseDepth{0};
+};
+
+constexpr std::array g_CullingBindings{VkDescriptorSetLayoutBinding{.binding = 0,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 1,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 2,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 3,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 4,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 5,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT},
+                                       VkDescriptorSetLayoutBinding{.binding = 6,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT}};
+
+luvk::InstanceCulling::InstanceCulling(const std::shared_ptr<Device>&         DeviceModule,
+                                       const std::shared_ptr<Memory>&         MemoryModule,
+                                       const std::shared_ptr<DescriptorPool>& PoolModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule),
+      m_PoolModule(PoolModule) {}
+
+void luvk::InstanceCulling::CreateCulling(const CreationArguments& Arguments)
+{
+    std::vector<std::uint32_t> FrustumCode(std::begin(Arguments.FrustumShader), std::end(Arguments.FrustumShader));
+    std::vector<std::uint32_t> OcclusionCode(std::begin(Arguments.OcclusionShader), std::end(Arguments.OcclusionShader));
+
+#ifdef LUVK_SLANG_INCLUDED
+    if (std::empty(FrustumCode))
+    {
+        FrustumCode = CompileShader(Shaders::InstanceCulling);
+    }
+
+    if (std::empty(OcclusionCode))
+    {
+        OcclusionCode = CompileShader(std::string(Shaders::InstanceCullingOcclusionDefine) + std::string(Shaders::InstanceCulling));
+    }
+#endif
+
+    if (std::empty(FrustumCode))
+    {
+        throw std::runtime_error("Instance culling requires the frustum culling shader SPIR-V.");
+    }
+
+    for (std::uint32_t Frame = 0U; Frame < Constants::ImageCount; ++Frame)
+    {
+        std::shared_ptr<Buffer>& ViewBuffer = m_ViewBuffers.at(Frame);
+
+        ViewBuffer = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        ViewBuffer->CreateBuffer({.Size = sizeof(ViewInfo),
+                                  .Usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                  .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                  .Name = "Culling View"});
+    }
+
+    m_LayoutOwner = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+    m_LayoutOwner->CreateLayout({.Bindings = g_CullingBindings});
+
+    constexpr VkPushConstantRange PushConstants{.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(CullingParameters)};
+    const VkDescriptorSetLayout   SetLayout = m_LayoutOwner->GetLayout();
+
+    m_FrustumPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+    m_FrustumPipeline->CreateComputePipeline({.ComputeShader = FrustumCode,
+                                              .SetLayouts = std::span(&SetLayout, 1U),
+                                              .PushConstants = std::span(&PushConstants, 1U)});
+
+    if (!std::empty(OcclusionCode))
+    {
+        m_OcclusionPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+        m_OcclusionPipeline->CreateComputePipeline({.ComputeShader = OcclusionCode,
+                                                    .SetLayouts = std::span(&SetLayout, 1U),
+                                                    .PushConstants = std::span(&PushConstants, 1U)});
+    }
+}
+
+std::uint32_t luvk::InstanceCulling::RegisterTarget()
+{
+    if (!m_LayoutOwner)
+    {
+        throw std::runtime_error("Instance culling must be created before registering targets.");
+    }
+
+    auto TargetIt = std::ranges::find_if(m_Targets,
+                                         [](const Target& Entry)
+                                         {
+                                             return !Entry.Active;
+                                         });
+
+    if (TargetIt == std::end(m_Targets))
+    {
+        TargetIt = m_Targets.emplace(std::end(m_Targets));
+    }
+
+    TargetIt->Active = true;
+
+    for (TargetFrame& FrameIt : TargetIt->Frames)
+    {
+        FrameIt.Command = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        FrameIt.Command->CreateBuffer({.Size = sizeof(VkDrawIndexedIndirectCommand),
+                                       .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                                VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                       .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                       .Name = "Culling Command"});
+
+        FrameIt.Set = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+        FrameIt.Set->UseLayout(m_LayoutOwner->GetLayout(), g_CullingBindings);
+        FrameIt.Set->Allocate();
+    }
+
+    return static_cast<std::uint32_t>(std::distance(std::begin(m_Targets), TargetIt));
+}
+
+void luvk::InstanceCulling::ReleaseTarget(const std::uint32_t TargetIndex)
+{
+    if (TargetIndex < std::size(m_Targets))
+    {
+        m_Targets.at(TargetIndex) = {};
+    }
+}
+
+void luvk::InstanceCulling::SetTargetInstances(const std::uint32_t                   TargetIndex,
+                                               const std::uint32_t                   FrameIndex,
+                                               const TargetInfo&                     Info,
+                                               const std::span<const InstanceBounds> Bounds)
+{
+    Target& Entry = m_Targets.at(TargetIndex);
+
+    if (!Entry.Active)
+    {
+        throw std::runtime_error("Instance culling target is not registered.");
+    }
+
+    if (Info.InstanceStride == 0U || Info.InstanceStride % sizeof(std::uint32_t) != 0U)
+    {
+        throw std::runtime_error("Instance culling requires a non-zero instance stride aligned to 4 bytes.");
+    }
+
+    TargetFrame& Frame = Entry.Frames.at(FrameIndex);
+    const auto   Count = static_cast<std::uint32_t>(std::size(Bounds));
+
+    Frame.Info          = Info;
+    Frame.InstanceCount = Info.SourceInstances != VK_NULL_HANDLE ? Count : 0U;
+
+    if (Frame.InstanceCount == 0U)
+    {
+        return;
+    }
+
+    ResizeTarget(Frame, FrameIndex, Count, Info.InstanceStride);
+
+    Frame.Bounds->Upload(std::as_bytes(Bounds));
+    Frame.Set->UpdateBuffer(Info.SourceInstances, VK_WHOLE_SIZE, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+}
+
+void luvk::InstanceCulling::SetView(const ViewInfo& View, const std::uint32_t FrameIndex) const
+{
+    if (const std::shared_ptr<Buffer>& ViewBuffer = m_ViewBuffers.at(FrameIndex))
+    {
+        ViewBuffer->Upload(std::as_bytes(std::span(&View, 1U)));
+    }
+}
+
+void luvk::InstanceCulling::SetDepthPyramid(const DepthPyramidInfo& Pyramid)
+{
+    m_Pyramid = Pyramid;
+}
+
+void luvk::InstanceCulling::RecordCulling(CommandRecorder& Recorder) const
+{
+    if (!m_FrustumPipeline)
+    {
+        return;
+    }
+
+    std::vector<const TargetFrame*> Pending{};
+    Pending.reserve(std::size(m_Targets));
+
+    for (const Target& TargetIt : m_Targets)
+    {
+        if (const TargetFrame& Frame = TargetIt.Frames.at(m_FrameIndex);
+            TargetIt.Active && Frame.InstanceCount > 0U)
+        {
+            Pending.push_back(&Frame);
+        }
+    }
+
+    if (std::empty(Pending))
+    {
+        return;
+    }
+
+    for (const TargetFrame* FrameIt : Pending)
+    {
+        const std::array<std::uint32_t, 5U> Command{FrameIt->Info.ElementCount, 0U, 0U, 0U, 0U};
+        vkCmdUpdateBuffer(Recorder, FrameIt->Command->GetHandle(), 0, sizeof(Command), std::data(Command));
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+    const bool             UseOcclusion = HasDepthPyramid();
+    const Pipeline&        Culling      = UseOcclusion ? *m_OcclusionPipeline : *m_FrustumPipeline;
+    const VkPipelineLayout Layout       = Culling.GetPipelineLayout();
+
+    Recorder.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, Culling.GetPipeline(), Layout);
+
+    for (const TargetFrame* FrameIt : Pending)
+    {
+        if (UseOcclusion)
+        {
+            FrameIt->Set->UpdateImage(m_Pyramid.View, m_Pyramid.Sampler, 6, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, m_Pyramid.Layout);
+        }
+
+        FrameIt->Set->Flush();
+
+        const CullingParameters Parameters{.InstanceCount = FrameIt->InstanceCount,
+                                           .InstanceStride = FrameIt->Info.InstanceStride / static_cast<std::uint32_t>(sizeof(std::uint32_t)),
+                                           .PyramidMips = m_Pyramid.MipCount,
+                                           .PyramidWidth = static_cast<float>(m_Pyramid.Extent.width),
+                                           .PyramidHeight = static_cast<float>(m_Pyramid.Extent.height),
+                                           .ReverseDepth = m_Pyramid.ReverseDepth ? 1U : 0U};
+
+        Recorder.BindDescriptorSet(VK_PIPELINE_BIND_POINT_COMPUTE, Layout, 0, FrameIt->Set->GetHandle());
+        Recorder.PushConstants(Layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, std::as_bytes(std::span(&Parameters, 1U)));
+
+        vkCmdDispatch(Recorder, (FrameIt->InstanceCount + g_CullingGroupSize - 1U) / g_CullingGroupSize, 1U, 1U);
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_ACCESS_SHADER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                             VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_SHADER_READ_BIT);
+}
+
+std::array<std::array<float, 4>, 6> luvk::InstanceCulling::ExtractFrustumPlanes(const std::array<float, 16>& ViewProjection) noexcept
+{
+    auto Row = [&ViewProjection](const std::size_t Index)
+    {
+        return std::array{ViewProjection.at(Index), ViewProjection.at(4U + Index), ViewProjection.at(8U + Index), ViewProjection.at(12U + Index)};
+    };
+
+    const std::array<float, 4> X = Row(0U);
+    const std::array<float, 4> Y = Row(1U);
+    const std::array<float, 4> Z = Row(2U);
+    const std::array<float, 4> W = Row(3U);
+
+    std::array<std::array<float, 4>, 6> Planes{};
+
+    for (std::size_t Component = 0U; Component < 4U; ++Component)
+    {
+        Planes.at(0U).at(Component) = W.at(Component) + X.at(Component);
+        Planes.at(1U).at(Component) = W.at(Component) - X.at(Component);
+        Planes.at(2U).at(Component) = W.at(Component) + Y.at(Component);
+        Planes.at(3U).at(Component) = W.at(Component) - Y.at(Component);
+        Planes.at(4U).at(Component) = Z.at(Component);
+        Planes.at(5U).at(Component) = W.at(Component) - Z.at(Component);
+    }
+
+    for (std::array<float, 4>& PlaneIt : Planes)
+    {
+        if (const float Length = std::sqrt(PlaneIt.at(0U) * PlaneIt.at(0U) + PlaneIt.at(1U) * PlaneIt.at(1U) + PlaneIt.at(2U) * PlaneIt.at(2U));
+            Length > 0.F)
+        {
+            for (float& ComponentIt : PlaneIt)
+            {
+                ComponentIt /= Length;
+            }
+        }
+    }
+
+    return Planes;
+}
+
+bool luvk::InstanceCulling::IsTargetReady(const std::uint32_t TargetIndex, const std::uint32_t FrameIndex) const noexcept
+{
+    if (TargetIndex >= std::size(m_Targets) || FrameIndex >= Constants::ImageCount || !m_FrustumPipeline)
+    {
+        return false;
+    }
+
+    const Target& Entry = m_Targets.at(TargetIndex);
+    return Entry.Active && Entry.Frames.at(FrameIndex).InstanceCount > 0U;
+}
+
+std::shared_ptr<luvk::Buffer> luvk::InstanceCulling::GetCompactedInstances(const std::uint32_t TargetIndex, const std::uint32_t FrameIndex) const
+{
+    return m_Targets.at(TargetIndex).Frames.at(FrameIndex).Compacted;
+}
+
+std::shared_ptr<luvk::Buffer> luvk::InstanceCulling::GetVisibleIndices(const std::uint32_t TargetIndex, const std::uint32_t FrameIndex) const
+{
+    return m_Targets.at(TargetIndex).Frames.at(FrameIndex).Indices;
+}
+
+std::shared_ptr<luvk::Buffer> luvk::InstanceCulling::GetDrawCommand(const std::uint32_t TargetIndex, const std::uint32_t FrameIndex) const
+{
+    return m_Targets.at(TargetIndex).Frames.at(FrameIndex).Command;
+}
+
+void luvk::InstanceCulling::ClearResources()
+{
+    m_Targets.clear();
+    m_FrustumPipeline.reset();
+    m_OcclusionPipeline.reset();
+    m_LayoutOwner.reset();
+
+    for (std::shared_ptr<Buffer>& BufferIt : m_ViewBuffers)
+    {
+        BufferIt.reset();
+    }
+
+    m_Pyramid = {};
+}
+
+void luvk::InstanceCulling::ResizeTarget(TargetFrame&        Frame,
+                                         const std::uint32_t FrameIndex,
+                                         const std::uint32_t InstanceCount,
+                                         const std::uint32_t InstanceStride)
+{
+    if (InstanceCount <= Frame.Capacity && Frame.Compacted && Frame.Compacted->GetSize() >= VkDeviceSize{InstanceCount} * InstanceStride)
+    {
+        return;
+    }
+
+    Frame.Capacity = std::max(InstanceCount, Frame.Capacity + Frame.Capacity / 2U);
+
+    Frame.Bounds = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    Frame.Bounds->CreateBuffer({.Size = sizeof(InstanceBounds) * Frame.Capacity,
+                                .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                .Name = "Culling Bounds"});
+
+    Frame.Compacted = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    Frame.Compacted->CreateBuffer({.Size = VkDeviceSize{Frame.Capacity} * InstanceStride,
+                                   .Usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                   .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                   .Name = "Culling Instances"});
+
+    Frame.Indices = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    Frame.Indices->CreateBuffer({.Size = sizeof(std::uint32_t) * Frame.Capacity,
+                                 .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                 .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                 .Name = "Culling Indices"});
+
+    const std::shared_ptr<Buffer>& ViewBuffer = m_ViewBuffers.at(FrameIndex);
+
+    Frame.Set->UpdateBuffer(ViewBuffer->GetHandle(), ViewBuffer->GetSize(), 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    Frame.Set->UpdateBuffer(Frame.Bounds->GetHandle(), Frame.Bounds->GetSize(), 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    Frame.Set->UpdateBuffer(Frame.Compacted->GetHandle(), Frame.Compacted->GetSize(), 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    Frame.Set->UpdateBuffer(Frame.Indices->GetHandle(), Frame.Indices->GetSize(), 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    Frame.Set->UpdateBuffer(Frame.Command->GetHandle(), Frame.Command->GetSize(), 5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+}
@@ -22,20 +22,75 @@
 #endif
 #include <vk_mem_alloc.h>
 
+template <typename Features>
+static void QueryFeatureChain(const VkPhysicalDevice PhysicalDevice, Features& Output, const void*& Chain)
+{
+    Output.pNext = nullptr;
+
+    VkPhysicalDeviceFeatures2 Query{.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, .pNext = &Output};
+    vkGetPhysicalDeviceFeatures2(PhysicalDevice, &Query);
+
+    Output.pNext = const_cast<void*>(Chain);
+    Chain        = &Output;
+}
+
 luvk::Memory::Memory(const std::shared_ptr<Renderer>& RendererModule, const std::shared_ptr<Device>& DeviceModule)
     : m_DeviceModule(DeviceModule),
       m_RendererModule(RendererModule) {}
 
+const void* luvk::Memory::GetDeviceFeatureChain() const noexcept
+{
+    if (!m_DeviceModule)
+    {
+        return nullptr;
+    }
+
+    const DeviceExtensions& Extensions     = m_DeviceModule->GetExtensions();
+    const VkPhysicalDevice  PhysicalDevice = m_DeviceModule->GetPhysicalDevice();
+    const void*             Chain          = nullptr;
+
+    m_CoherentMemoryFeatures = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD};
+    m_Maintenance4Features   = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES};
+    m_Maintenance5Features   = {.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES_KHR};
+
+    if (!m_DeviceModule->HasFeatureStructure(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES) &&
+        Extensions.IsExtensionEnabled(VK_KHR_MAINTENANCE_4_EXTENSION_NAME))
+    {
+        QueryFeatureChain(PhysicalDevice, m_Maintenance4Features, Chain);
+    }
+
+    if (!m_DeviceModule->HasFeatureStructure(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES) &&
+        Extensions.IsExtensionEnabled(VK_KHR_MAINTENANCE_5_EXTENSION_NAME))
+    {
+        QueryFeatureChain(PhysicalDevice, m_Maintenance5Features, Chain);
+    }
+
+    if (Extensions.IsExtensionEnabled(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME))
+    {
+        QueryFeatureChain(PhysicalDevice, m_CoherentMemoryFeatures, Chain);
+    }
+
+    if (Extensions.HasAvailableExtension(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME))
+    {
+        m_MemoryPriorityFeatures.pNext = const_cast<void*>(Chain);
+        Chain                          = &m_MemoryPriorityFeatures;
+    }
+
+    return Chain;
+}
+
 void luvk::Memory::InitializeAllocator(const VmaAllocatorCreateFlags Flags)
 {
     VkPhysicalDeviceMemoryProperties MemProps{};
 
     vkGetPhysicalDeviceMemoryProperties(m_DeviceModule->GetPhysicalDevice(), &MemProps);
 
+    m_AllocatorFlags = Flags | GetSupportedAllocatorFlags();
+
     const VmaVulkanFunctions VulkanFunctions{.vkGetInstanceProcAddr = vkGetInstanceProcAddr,
                                              .vkGetDeviceProcAddr = vkGetDeviceProcAddr};
 
-    const VmaAllocatorCreateInfo AllocatorInfo{.flags = Flags | VMA_ALLOCATOR_CREATE_EXT_MEMORY_PRIORITY_BIT,
+    const VmaAllocatorCreateInfo AllocatorInfo{.flags = m_AllocatorFlags,
                                                .physicalDevice = m_DeviceModule->GetPhysicalDevice(),
                                                .device = m_DeviceModule->GetLogicalDevice(),
                                                .preferredLargeHeapBlockSize = 0U,
@@ -44,7 +99,7 @@ void luvk::Memory::InitializeAllocator(const VmaAllocatorCreateFlags Flags)
                                                .pHeapSizeLimit = nullptr,
                                                .pVulkanFunctions = &VulkanFunctions,
                                                .instance = m_RendererModule->GetInstance(),
-                                               .vulkanApiVersion = VK_MAKE_API_VERSION(0, 1, 0, 0),
+                                               .vulkanApiVersion = m_DeviceModule->GetEffectiveApiVersion(),
                                                .pTypeExternalMemoryHandleTypes = nullptr};
 
     if (!LUVK_EXECUTE(vmaCreateAllocator(&AllocatorInfo, &m_Allocator)))
@@ -55,6 +110,62 @@ void luvk::Memory::InitializeAllocator(const VmaAllocatorCreateFlags Flags)
     GetEventSystem().Execute(MemoryEvents::OnAllocatorCreated);
 }
 
+VmaAllocatorCreateFlags luvk::Memory::GetSupportedAllocatorFlags() const
+{
+    const DeviceExtensions& Extensions = m_DeviceModule->GetExtensions();
+    const std::uint32_t     ApiVersion = m_DeviceModule->GetEffectiveApiVersion();
+
+    VmaAllocatorCreateFlags Output = 0U;
+
+    if (ApiVersion < VK_API_VERSION_1_1)
+    {
+        if (Extensions.IsExtensionEnabled(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME) && Extensions.IsExtensionEnabled(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME))
+        {
+            Output |= VMA_ALLOCATOR_CREATE_KHR_DEDICATED_ALLOCATION_BIT;
+        }
+
+        if (Extensions.IsExtensionEnabled(VK_KHR_BIND_MEMORY_2_EXTENSION_NAME))
+        {
+            Output |= VMA_ALLOCATOR_CREATE_KHR_BIND_MEMORY2_BIT;
+        }
+    }
+
+    if (Extensions.IsExtensionEnabled(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) &&
+        (ApiVersion >= VK_API_VERSION_1_1 || m_RendererModule->GetExtensions().IsExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)))
+    {
+        Output |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
+    if (Extensions.IsExtensionEnabled(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME))
+    {
+        Output |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_PRIORITY_BIT;
+    }
+
+    if (Extensions.IsExtensionEnabled(VK_AMD_DEVICE_COHERENT_MEMORY_EXTENSION_NAME) && m_CoherentMemoryFeatures.deviceCoherentMemory == VK_TRUE)
+    {
+        Output |= VMA_ALLOCATOR_CREATE_AMD_DEVICE_COHERENT_MEMORY_BIT;
+    }
+
+    if (m_DeviceModule->SupportsBufferDeviceAddress())
+    {
+        Output |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
+
+    if ((m_DeviceModule->HasFeatureStructure(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES) && m_DeviceModule->GetVulkan13Features().maintenance4 == VK_TRUE) ||
+        (Extensions.IsExtensionEnabled(VK_KHR_MAINTENANCE_4_EXTENSION_NAME) && m_Maintenance4Features.maintenance4 == VK_TRUE))
+    {
+        Output |= VMA_ALLOCATOR_CREATE_KHR_MAINTENANCE4_BIT;
+    }
+
+    if ((m_DeviceModule->HasFeatureStructure(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES) && m_DeviceModule->GetVulkan14Features().maintenance5 == VK_TRUE) ||
+        (Extensions.IsExtensionEnabled(VK_KHR_MAINTENANCE_5_EXTENSION_NAME) && m_Maintenance5Features.maintenance5 == VK_TRUE))
+    {
+        Output |= VMA_ALLOCATOR_CREATE_KHR_MAINTENANCE5_BIT;
+    }
+
+    return Output;
+}
+
 void luvk::Memory::ClearResources()
 {
     if (m_Allocator != VK_NULL_HANDLE)
@@ -0,0 +1,440 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/Meshlets.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "luvk/Libraries/ShaderCompiler.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Resources/Buffer.hpp"
+#include "luvk/Resources/DescriptorSet.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Shaders/Meshlets.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
+
+static_assert(sizeof(luvk::Meshlets::Meshlet) == 64U);
+static_assert(sizeof(luvk::Meshlets::ViewInfo) == 176U);
+
+using Float3 = std::array<float, 3>;
+
+constexpr auto g_UnassignedVertex   = std::numeric_limits<std::uint32_t>::max();
+constexpr auto g_MinConeDot         = 0.1F;
+constexpr auto g_MeshletShaderStage = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT;
+
+struct MeshletParameters
+{
+    std::array<float, 16> Model{};
+    std::uint32_t         MeshletCount{0};
+    std::uint32_t         VertexStride{0};
+    std::uint32_t         PositionOffset{0};
+    std::uint32_t         Padding{0};
+};
+
+static_assert(sizeof(MeshletParameters) == luvk::Meshlets::GetPushConstantRange().size);
+
+constexpr std::array g_MeshletBindings{VkDescriptorSetLayoutBinding{.binding = 0,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = g_MeshletShaderStage},
+                                       VkDescriptorSetLayoutBinding{.binding = 1,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = g_MeshletShaderStage},
+                                       VkDescriptorSetLayoutBinding{.binding = 2,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_MESH_BIT_EXT},
+                                       VkDescriptorSetLayoutBinding{.binding = 3,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_MESH_BIT_EXT},
+                                       VkDescriptorSetLayoutBinding{.binding = 4,
+                                                                    .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                    .descriptorCount = 1,
+                                                                    .stageFlags = VK_SHADER_STAGE_MESH_BIT_EXT}};
+
+static Float3 Subtract(const Float3& Left, const Float3& Right) noexcept
+{
+    return {Left[0] - Right[0], Left[1] - Right[1], Left[2] - Right[2]};
+}
+
+static float Dot(const Float3& Left, const Float3& Right) noexcept
+{
+    return Left[0] * Right[0] + Left[1] * Right[1] + Left[2] * Right[2];
+}
+
+static Float3 Cross(const Float3& Left, const Float3& Right) noexcept
+{
+    return {Left[1] * Right[2] - Left[2] * Right[1], Left[2] * Right[0] - Left[0] * Right[2], Left[0] * Right[1] - Left[1] * Right[0]};
+}
+
+static Float3 ReadPosition(const luvk::Meshlets::BuildArguments& Arguments, const std::uint32_t Vertex) noexcept
+{
+    Float3 Position{};
+    std::memcpy(std::data(Position), std::data(Arguments.Vertices) + static_cast<std::size_t>(Vertex) * Arguments.VertexStride + Arguments.PositionOffset, sizeof(Position));
+    return Position;
+}
+
+static void ComputeMeshletBounds(const luvk::Meshlets::BuildArguments& Arguments, const luvk::Meshlets::MeshletData& Data, luvk::Meshlets::Meshlet& Target)
+{
+    const std::span Vertices  = std::span(Data.Vertices).subspan(Target.VertexOffset, Target.VertexCount);
+    const std::span Triangles = std::span(Data.Triangles).subspan(Target.TriangleOffset, Target.TriangleCount);
+
+    Float3 Minimum{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    Float3 Maximum{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+
+    for (const std::uint32_t VertexIt : Vertices)
+    {
+        const Float3 Position = ReadPosition(Arguments, VertexIt);
+
+        for (std::size_t Axis = 0U; Axis < 3U; ++Axis)
+        {
+            Minimum[Axis] = std::min(Minimum[Axis], Position[Axis]);
+            Maximum[Axis] = std::max(Maximum[Axis], Position[Axis]);
+        }
+    }
+
+    Target.Center = {(Minimum[0] + Maximum[0]) * 0.5F, (Minimum[1] + Maximum[1]) * 0.5F, (Minimum[2] + Maximum[2]) * 0.5F};
+    Target.Radius = 0.F;
+
+    for (const std::uint32_t VertexIt : Vertices)
+    {
+        const Float3 Offset = Subtract(ReadPosition(Arguments, VertexIt), Target.Center);
+        Target.Radius       = std::max(Target.Radius, std::sqrt(Dot(Offset, Offset)));
+    }
+
+    auto TriangleNormal = [&](const std::uint32_t Packed, Float3& Origin) -> Float3
+    {
+        Origin = ReadPosition(Arguments, Vertices[Packed & 0xFFU]);
+
+        const Float3 Normal = Cross(Subtract(ReadPosition(Arguments, Vertices[Packed >> 8U & 0xFFU]), Origin),
+                                    Subtract(ReadPosition(Arguments, Vertices[Packed >> 16U & 0xFFU]), Origin));
+
+        const float Length = std::sqrt(Dot(Normal, Normal));
+        return Length > 0.F ? Float3{Normal[0] / Length, Normal[1] / Length, Normal[2] / Length} : Float3{};
+    };
+
+    Float3 Axis{};
+    Float3 Origin{};
+
+    for (const std::uint32_t TriangleIt : Triangles)
+    {
+        const Float3 Normal = TriangleNormal(TriangleIt, Origin);
+        Axis                = {Axis[0] + Normal[0], Axis[1] + Normal[1], Axis[2] + Normal[2]};
+    }
+
+    Target.ConeAxis   = {};
+    Target.ConeApex   = Target.Center;
+    Target.ConeCutoff = 1.F;
+
+    const float AxisLength = std::sqrt(Dot(Axis, Axis));
+
+    if (AxisLength <= 0.F)
+    {
+        return;
+    }
+
+    Axis = {Axis[0] / AxisLength, Axis[1] / AxisLength, Axis[2] / AxisLength};
+
+    float MinimumDot = 1.F;
+
+    for (const std::uint32_t TriangleIt : Triangles)
+    {
+        if (const Float3 Normal = TriangleNormal(TriangleIt, Origin);
+            Dot(Normal, Normal) > 0.F)
+        {
+            MinimumDot = std::min(MinimumDot, Dot(Axis, Normal));
+        }
+    }
+
+    if (MinimumDot <= g_MinConeDot)
+    {
+        return;
+    }
+
+    float MaximumDistance = 0.F;
+
+    for (const std::uint32_t TriangleIt : Triangles)
+    {
+        if (const Float3 Normal = TriangleNormal(TriangleIt, Origin);
+            Dot(Normal, Normal) > 0.F)
+        {
+            MaximumDistance = std::max(MaximumDistance, Dot(Subtract(Target.Center, Origin), Normal) / Dot(Axis, Normal));
+        }
+    }
+
+    Target.ConeAxis   = Axis;
+    Target.ConeApex   = {Target.Center[0] - Axis[0] * MaximumDistance, Target.Center[1] - Axis[1] * MaximumDistance, Target.Center[2] - Axis[2] * MaximumDistance};
+    Target.ConeCutoff = std::sqrt(1.F - MinimumDot * MinimumDot);
+}
+
+luvk::Meshlets::Meshlets(const std::shared_ptr<Device>&         DeviceModule,
+                         const std::shared_ptr<Memory>&         MemoryModule,
+                         const std::shared_ptr<DescriptorPool>& PoolModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule),
+      m_PoolModule(PoolModule) {}
+
+const void* luvk::Meshlets::GetDeviceFeatureChain() const noexcept
+{
+    if (m_DeviceModule && m_DeviceModule->GetExtensions().HasAvailableExtension(VK_EXT_MESH_SHADER_EXTENSION_NAME))
+    {
+        return &m_MeshShaderFeatures;
+    }
+
+    return nullptr;
+}
+
+void luvk::Meshlets::CreateMeshlets(const CreationArguments& Arguments)
+{
+    m_SetIndex = Arguments.SetIndex;
+    m_TaskShader.assign(std::begin(Arguments.TaskShader), std::end(Arguments.TaskShader));
+    m_MeshShader.assign(std::begin(Arguments.MeshShader), std::end(Arguments.MeshShader));
+
+#ifdef LUVK_SLANG_INCLUDED
+    const std::string SetDefine = "#define LUVK_MESHLET_SET " + std::to_string(m_SetIndex) + "\n";
+
+    if (std::empty(m_TaskShader))
+    {
+        m_TaskShader = CompileShader(SetDefine + std::string(Shaders::MeshletCommon) + std::string(Shaders::MeshletTask), "spirv_1_4");
+    }
+
+    if (std::empty(m_MeshShader))
+    {
+        m_MeshShader = CompileShader(SetDefine + std::string(Shaders::MeshletCommon) + std::string(Shaders::MeshletMesh), "spirv_1_4");
+    }
+#endif
+
+    if (std::empty(m_TaskShader) || std::empty(m_MeshShader))
+    {
+        throw std::runtime_error("Meshlets require the task and mesh shaders SPIR-V.");
+    }
+
+    for (std::shared_ptr<Buffer>& ViewBufferIt : m_ViewBuffers)
+    {
+        ViewBufferIt = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        ViewBufferIt->CreateBuffer({.Size = sizeof(ViewInfo),
+                                    .Usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                    .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                    .Name = "Meshlet View"});
+    }
+
+    m_LayoutOwner = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+    m_LayoutOwner->CreateLayout({.Bindings = g_MeshletBindings});
+}
+
+luvk::Meshlets::MeshletData luvk::Meshlets::BuildMeshlets(const BuildArguments& Arguments)
+{
+    if (Arguments.MaxVertices < 3U || Arguments.MaxVertices > MaxVertices || Arguments.MaxTriangles == 0U || Arguments.MaxTriangles > MaxTriangles)
+    {
+        throw std::runtime_error("Meshlet limits exceed the mesh shader output limits.");
+    }
+
+    if (Arguments.VertexStride < Arguments.PositionOffset + sizeof(Float3) || std::size(Arguments.Indices) % 3U != 0U)
+    {
+        throw std::runtime_error("Meshlet geometry requires a float3 position per vertex and a triangle list.");
+    }
+
+    const auto VertexCount = static_cast<std::uint32_t>(std::size(Arguments.Vertices) / Arguments.VertexStride);
+
+    MeshletData Data{};
+    Data.Vertices.reserve(std::size(Arguments.Indices));
+    Data.Triangles.reserve(std::size(Arguments.Indices) / 3U);
+
+    std::vector<std::uint32_t> LocalIndex(VertexCount, g_UnassignedVertex);
+    Meshlet                    Current{};
+
+    auto Flush = [&]
+    {
+        if (Current.TriangleCount == 0U)
+        {
+            return;
+        }
+
+        for (const std::uint32_t VertexIt : std::span(Data.Vertices).subspan(Current.VertexOffset, Current.VertexCount))
+        {
+            LocalIndex[VertexIt] = g_UnassignedVertex;
+        }
+
+        ComputeMeshletBounds(Arguments, Data, Current);
+        Data.Meshlets.push_back(Current);
+
+        Current = Meshlet{.VertexOffset = static_cast<std::uint32_t>(std::size(Data.Vertices)),
+                          .TriangleOffset = static_cast<std::uint32_t>(std::size(Data.Triangles))};
+    };
+
+    auto Assign = [&](const std::uint32_t Vertex)
+    {
+        if (LocalIndex[Vertex] == g_UnassignedVertex)
+        {
+            LocalIndex[Vertex] = Current.VertexCount++;
+            Data.Vertices.push_back(Vertex);
+        }
+
+        return LocalIndex[Vertex];
+    };
+
+    for (std::size_t Index = 0U; Index < std::size(Arguments.Indices); Index += 3U)
+    {
+        const std::uint32_t A = Arguments.Indices[Index];
+        const std::uint32_t B = Arguments.Indices[Index + 1U];
+        const std::uint32_t C = Arguments.Indices[Index + 2U];
+
+        if (A >= VertexCount || B >= VertexCount || C >= VertexCount)
+        {
+            throw std::runtime_error("Meshlet index references a vertex out of range.");
+        }
+
+        const std::uint32_t NewVertices = static_cast<std::uint32_t>(LocalIndex[A] == g_UnassignedVertex) +
+                                          static_cast<std::uint32_t>(LocalIndex[B] == g_UnassignedVertex && B != A) +
+                                          static_cast<std::uint32_t>(LocalIndex[C] == g_UnassignedVertex && C != A && C != B);
+
+        if (Current.VertexCount + NewVertices > Arguments.MaxVertices || Current.TriangleCount >= Arguments.MaxTriangles)
+        {
+            Flush();
+        }
+
+        const std::uint32_t LocalA = Assign(A);
+        const std::uint32_t LocalB = Assign(B);
+        const std::uint32_t LocalC = Assign(C);
+
+        Data.Triangles.push_back(LocalA | LocalB << 8U | LocalC << 16U);
+        ++Current.TriangleCount;
+    }
+
+    Flush();
+
+    return Data;
+}
+
+std::uint32_t luvk::Meshlets::RegisterGeometry(const MeshletData&               Data,
+                                               const std::span<const std::byte> Vertices,
+                                               const std::uint32_t              VertexStride,
+                                               const std::uint32_t              PositionOffset)
+{
+    if (!m_LayoutOwner)
+    {
+        throw std::runtime_error("Meshlets must be created before registering geometry.");
+    }
+
+    if (std::empty(Data.Meshlets) || std::empty(Vertices) || VertexStride % sizeof(std::uint32_t) != 0U || PositionOffset % sizeof(std::uint32_t) != 0U)
+    {
+        throw std::runtime_error("Meshlet geometry requires meshlets and vertices aligned to 4 bytes.");
+    }
+
+    auto GeometryIt = std::ranges::find_if(m_Geometries,
+                                           [](const Geometry& Entry)
+                                           {
+                                               return !Entry.Active;
+                                           });
+
+    if (GeometryIt == std::end(m_Geometries))
+    {
+        GeometryIt = m_Geometries.emplace(std::end(m_Geometries));
+    }
+
+    auto CreateStorage = [this](const std::span<const std::byte> Source, const char* const Name)
+    {
+        auto Storage = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        Storage->CreateBuffer({.Size = std::size(Source),
+                               .Usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                               .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                               .PreferDirectWrites = true,
+                               .Name = Name});
+        Storage->Upload(Source);
+        return Storage;
+    };
+
+    GeometryIt->Active           = true;
+    GeometryIt->MeshletCount     = static_cast<std::uint32_t>(std::size(Data.Meshlets));
+    GeometryIt->VertexStride     = VertexStride;
+    GeometryIt->PositionOffset   = PositionOffset;
+    GeometryIt->Meshlets         = CreateStorage(std::as_bytes(std::span(Data.Meshlets)), "Meshlets");
+    GeometryIt->MeshletVertices  = CreateStorage(std::as_bytes(std::span(Data.Vertices)), "Meshlet Vertices");
+    GeometryIt->MeshletTriangles = CreateStorage(std::as_bytes(std::span(Data.Triangles)), "Meshlet Triangles");
+    GeometryIt->Vertices         = CreateStorage(Vertices, "Meshlet Vertex Data");
+
+    for (std::uint32_t Frame = 0U; Frame < Constants::ImageCount; ++Frame)
+    {
+        std::shared_ptr<DescriptorSet>& Set = GeometryIt->Sets.at(Frame);
+
+        Set = std::make_shared<DescriptorSet>(m_DeviceModule, m_PoolModule, m_MemoryModule);
+        Set->UseLayout(m_LayoutOwner->GetLayout(), g_MeshletBindings);
+        Set->Allocate();
+
+        Set->UpdateBuffer(m_ViewBuffers.at(Frame)->GetHandle(), sizeof(ViewInfo), 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        Set->UpdateBuffer(GeometryIt->Meshlets->GetHandle(), VK_WHOLE_SIZE, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Set->UpdateBuffer(GeometryIt->MeshletVertices->GetHandle(), VK_WHOLE_SIZE, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Set->UpdateBuffer(GeometryIt->MeshletTriangles->GetHandle(), VK_WHOLE_SIZE, 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Set->UpdateBuffer(GeometryIt->Vertices->GetHandle(), VK_WHOLE_SIZE, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        Set->Flush();
+    }
+
+    return static_cast<std::uint32_t>(std::distance(std::begin(m_Geometries), GeometryIt));
+}
+
+void luvk::Meshlets::ReleaseGeometry(const std::uint32_t GeometryIndex)
+{
+    if (GeometryIndex < std::size(m_Geometries))
+    {
+        m_Geometries.at(GeometryIndex) = {};
+    }
+}
+
+void luvk::Meshlets::SetView(const ViewInfo& View, const std::uint32_t FrameIndex) const
+{
+    if (const std::shared_ptr<Buffer>& ViewBuffer = m_ViewBuffers.at(FrameIndex))
+    {
+        ViewBuffer->Upload(std::as_bytes(std::span(&View, 1U)));
+    }
+}
+
+void luvk::Meshlets::RecordDraw(CommandRecorder&             Recorder,
+                                const std::uint32_t          GeometryIndex,
+                                const Pipeline&              MeshPipeline,
+                                const std::array<float, 16>& Model,
+                                const std::uint32_t          FrameIndex) const
+{
+    const Geometry& Entry = m_Geometries.at(GeometryIndex);
+
+    if (!Entry.Active || Entry.MeshletCount == 0U || !vkCmdDrawMeshTasksEXT)
+    {
+        return;
+    }
+
+    const VkPipelineLayout  Layout = MeshPipeline.GetPipelineLayout();
+    const MeshletParameters Parameters{.Model = Model,
+                                       .MeshletCount = Entry.MeshletCount,
+                                       .VertexStride = Entry.VertexStride,
+                                       .PositionOffset = Entry.PositionOffset};
+
+    Recorder.BindDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS, Layout, m_SetIndex, Entry.Sets.at(FrameIndex)->GetHandle());
+    Recorder.PushConstants(Layout, g_MeshletShaderStage, 0, std::as_bytes(std::span(&Parameters, 1U)));
+
+    vkCmdDrawMeshTasksEXT(Recorder, (Entry.MeshletCount + GroupSize - 1U) / GroupSize, 1U, 1U);
+}
+
+VkDescriptorSetLayout luvk::Meshlets::GetSetLayout() const noexcept
+{
+    return m_LayoutOwner ? m_LayoutOwner->GetLayout() : VK_NULL_HANDLE;
+}
+
+std::uint32_t luvk::Meshlets::GetMeshletCount(const std::uint32_t GeometryIndex) const
+{
+    return m_Geometries.at(GeometryIndex).MeshletCount;
+}
+
+void luvk::Meshlets::ClearResources()
+{
+    m_Geometries.clear();
+    m_ViewBuffers = {};
+    m_LayoutOwner.reset();
+    m_TaskShader.clear();
+    m_MeshShader.clear();
+}
@@ -0,0 +1,375 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/OcclusionQueries.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include "luvk/Libraries/ShaderCompiler.hpp"
+#include "luvk/Libraries/VulkanHelpers.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/Draw.hpp"
+#include "luvk/Modules/SwapChain.hpp"
+#include "luvk/Resources/Buffer.hpp"
+#include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Shaders/OcclusionProxy.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
+
+constexpr auto g_ProxyVertexCount = 36U;
+
+struct ProxyParameters
+{
+    std::array<float, 16> ViewProjection{};
+    std::array<float, 4>  Center{};
+    std::array<float, 4>  Extents{};
+};
+
+luvk::OcclusionQueries::OcclusionQueries(const std::shared_ptr<Device>&    DeviceModule,
+                                         const std::shared_ptr<Memory>&    MemoryModule,
+                                         const std::shared_ptr<SwapChain>& SwapChainModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule),
+      m_SwapChainModule(SwapChainModule) {}
+
+const void* luvk::OcclusionQueries::GetDeviceFeatureChain() const noexcept
+{
+    if (m_DeviceModule && m_DeviceModule->GetExtensions().HasAvailableExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME))
+    {
+        return &m_ConditionalRenderingFeatures;
+    }
+
+    return nullptr;
+}
+
+void luvk::OcclusionQueries::CreateQueries(const CreationArguments& Arguments)
+{
+    if (Arguments.MaxQueries == 0U)
+    {
+        throw std::runtime_error("Occlusion queries require a non-zero capacity.");
+    }
+
+    std::vector<std::uint32_t> VertexCode(std::begin(Arguments.VertexShader), std::end(Arguments.VertexShader));
+    std::vector<std::uint32_t> FragmentCode(std::begin(Arguments.FragmentShader), std::end(Arguments.FragmentShader));
+
+#ifdef LUVK_SLANG_INCLUDED
+    if (std::empty(VertexCode))
+    {
+        VertexCode = CompileShader(Shaders::OcclusionProxyVertex);
+    }
+
+    if (std::empty(FragmentCode))
+    {
+        FragmentCode = CompileShader(Shaders::OcclusionProxyFragment);
+    }
+#endif
+
+    if (std::empty(VertexCode) || std::empty(FragmentCode))
+    {
+        throw std::runtime_error("Occlusion queries require the proxy shaders SPIR-V.");
+    }
+
+    ClearResources();
+
+    const VkDevice           LogicalDevice  = m_DeviceModule->GetLogicalDevice();
+    const VkBufferUsageFlags PredicateUsage = SupportsConditionalRendering()
+                                                  ? VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+                                                  : VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+
+    m_MaxQueries = Arguments.MaxQueries;
+    m_Active.assign(m_MaxQueries, false);
+
+    const VkQueryPoolCreateInfo PoolInfo{.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                                         .queryType = VK_QUERY_TYPE_OCCLUSION,
+                                         .queryCount = m_MaxQueries};
+
+    for (FrameQueries& FrameIt : m_Frames)
+    {
+        if (!LUVK_EXECUTE(vkCreateQueryPool(LogicalDevice, &PoolInfo, nullptr, &FrameIt.Pool)))
+        {
+            throw std::runtime_error("Failed to create occlusion query pool.");
+        }
+
+        FrameIt.Predicates = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        FrameIt.Predicates->CreateBuffer({.Size = sizeof(std::uint32_t) * m_MaxQueries,
+                                          .Usage = PredicateUsage,
+                                          .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                                          .Name = "Occlusion Predicates"});
+
+        FrameIt.Issued.reserve(m_MaxQueries);
+    }
+
+    constexpr VkPushConstantRange PushConstants{.stageFlags = VK_SHADER_STAGE_VERTEX_BIT, .offset = 0, .size = sizeof(ProxyParameters)};
+
+    m_ProxyPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+    m_ProxyPipeline->CreateGraphicsPipeline({.Extent = m_SwapChainModule->GetExtent(),
+                                             .RenderPass = m_SwapChainModule->GetRenderPass(),
+                                             .VertexShader = VertexCode,
+                                             .FragmentShader = FragmentCode,
+                                             .PushConstants = std::span(&PushConstants, 1U),
+                                             .CullMode = VK_CULL_MODE_NONE,
+                                             .EnableDepthWrite = false,
+                                             .DepthCompareOp = Arguments.ReverseDepth ? VK_COMPARE_OP_GREATER_OR_EQUAL : VK_COMPARE_OP_LESS_OR_EQUAL,
+                                             .ColorWriteMask = 0U});
+}
+
+std::uint32_t luvk::OcclusionQueries::RegisterQuery()
+{
+    const auto QueryIt = std::ranges::find(m_Active, false);
+
+    if (QueryIt == std::end(m_Active))
+    {
+        throw std::runtime_error("Occlusion query capacity exhausted.");
+    }
+
+    *QueryIt = true;
+
+    const auto Query = static_cast<std::uint32_t>(std::distance(std::begin(m_Active), QueryIt));
+    m_PendingReset.push_back(Query);
+
+    return Query;
+}
+
+void luvk::OcclusionQueries::ReleaseQuery(const std::uint32_t Query)
+{
+    if (Query < std::size(m_Active))
+    {
+        m_Active.at(Query) = false;
+    }
+}
+
+void luvk::OcclusionQueries::SetViewProjection(const std::array<float, 16>& ViewProjection)
+{
+    m_ViewProjection = ViewProjection;
+}
+
+void luvk::OcclusionQueries::RegisterCommands(Draw& DrawModule)
+{
+    DrawModule.RegisterPreRenderCommand({.Callback = [Weak = weak_from_this()](CommandRecorder& Recorder)
+    {
+        const std::shared_ptr<OcclusionQueries> Queries = Weak.lock();
+
+        if (!Queries)
+        {
+            return false;
+        }
+
+        Queries->RecordReset(Recorder);
+        return true;
+    }});
+
+    DrawModule.RegisterPostPassCommand({.Callback = [Weak = weak_from_this()](CommandRecorder& Recorder)
+    {
+        const std::shared_ptr<OcclusionQueries> Queries = Weak.lock();
+
+        if (!Queries)
+        {
+            return false;
+        }
+
+        Queries->RecordResolve(Recorder);
+        return true;
+    }});
+}
+
+void luvk::OcclusionQueries::RecordReset(CommandRecorder& Recorder)
+{
+    FrameQueries& Frame = m_Frames.at(m_FrameIndex);
+
+    if (Frame.Pool == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    vkCmdResetQueryPool(Recorder, Frame.Pool, 0U, m_MaxQueries);
+    Frame.Issued.clear();
+
+    if (!SupportsConditionalRendering())
+    {
+        m_PendingReset.clear();
+        return;
+    }
+
+    if (std::empty(m_PendingReset))
+    {
+        return;
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT,
+                             0U,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT);
+
+    for (const std::uint32_t QueryIt : m_PendingReset)
+    {
+        for (const FrameQueries& FrameIt : m_Frames)
+        {
+            vkCmdFillBuffer(Recorder, FrameIt.Predicates->GetHandle(), sizeof(std::uint32_t) * QueryIt, sizeof(std::uint32_t), 1U);
+        }
+    }
+
+    m_PendingReset.clear();
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT,
+                             VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT);
+}
+
+void luvk::OcclusionQueries::RecordProxy(CommandRecorder& Recorder, const std::uint32_t Query, const InstanceCulling::InstanceBounds& Bounds)
+{
+    if (!m_ProxyPipeline)
+    {
+        return;
+    }
+
+    const std::array<float, 3> Extents = Bounds.Shape == InstanceCulling::BoundsShape::Sphere
+                                             ? std::array{Bounds.Radius, Bounds.Radius, Bounds.Radius}
+                                             : Bounds.Extents;
+
+    const ProxyParameters Parameters{.ViewProjection = m_ViewProjection,
+                                     .Center = {Bounds.Center.at(0U), Bounds.Center.at(1U), Bounds.Center.at(2U), 1.F},
+                                     .Extents = {Extents.at(0U), Extents.at(1U), Extents.at(2U), 0.F}};
+
+    RecordProxy(Recorder,
+                Query,
+                [this, &Parameters](CommandRecorder& ProxyRecorder)
+                {
+                    const VkPipelineLayout Layout = m_ProxyPipeline->GetPipelineLayout();
+
+                    ProxyRecorder.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, m_ProxyPipeline->GetPipeline(), Layout);
+                    ProxyRecorder.PushConstants(Layout, VK_SHADER_STAGE_VERTEX_BIT, 0, std::as_bytes(std::span(&Parameters, 1U)));
+
+                    vkCmdDraw(ProxyRecorder, g_ProxyVertexCount, 1U, 0U, 0U);
+                });
+}
+
+void luvk::OcclusionQueries::RecordProxy(CommandRecorder& Recorder, const std::uint32_t Query, const ProxyCallback& Proxy)
+{
+    FrameQueries& Frame = m_Frames.at(m_FrameIndex);
+
+    if (Frame.Pool == VK_NULL_HANDLE || Query >= m_MaxQueries || !m_Active.at(Query) || !Proxy)
+    {
+        return;
+    }
+
+    vkCmdBeginQuery(Recorder, Frame.Pool, Query, 0U);
+    Proxy(Recorder);
+    vkCmdEndQuery(Recorder, Frame.Pool, Query);
+
+    Frame.Issued.push_back(Query);
+}
+
+void luvk::OcclusionQueries::RecordResolve(CommandRecorder& Recorder)
+{
+    FrameQueries& Frame = m_Frames.at(m_FrameIndex);
+
+    if (Frame.Pool == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    if (!SupportsConditionalRendering())
+    {
+        Frame.Issued.clear();
+        return;
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT,
+                             0U,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT);
+
+    std::ranges::sort(Frame.Issued);
+
+    const auto Unique = std::ranges::unique(Frame.Issued);
+    Frame.Issued.erase(std::begin(Unique), std::end(Unique));
+
+    const VkBuffer Predicates = Frame.Predicates->GetHandle();
+    std::uint32_t  Visible    = 0U;
+
+    for (auto RunIt = std::begin(Frame.Issued); RunIt != std::end(Frame.Issued);)
+    {
+        if (*RunIt > Visible)
+        {
+            vkCmdFillBuffer(Recorder, Predicates, sizeof(std::uint32_t) * Visible, sizeof(std::uint32_t) * (*RunIt - Visible), 1U);
+        }
+
+        auto RunEnd = std::next(RunIt);
+
+        while (RunEnd != std::end(Frame.Issued) && *RunEnd == *std::prev(RunEnd) + 1U)
+        {
+            ++RunEnd;
+        }
+
+        vkCmdCopyQueryPoolResults(Recorder,
+                                  Frame.Pool,
+                                  *RunIt,
+                                  static_cast<std::uint32_t>(std::distance(RunIt, RunEnd)),
+                                  Predicates,
+                                  sizeof(std::uint32_t) * *RunIt,
+                                  sizeof(std::uint32_t),
+                                  VK_QUERY_RESULT_WAIT_BIT);
+
+        Visible = *std::prev(RunEnd) + 1U;
+        RunIt   = RunEnd;
+    }
+
+    if (Visible < m_MaxQueries)
+    {
+        vkCmdFillBuffer(Recorder, Predicates, sizeof(std::uint32_t) * Visible, sizeof(std::uint32_t) * (m_MaxQueries - Visible), 1U);
+    }
+
+    Recorder.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT,
+                             VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT);
+}
+
+bool luvk::OcclusionQueries::BeginConditional(CommandRecorder& Recorder, const std::uint32_t Query) const
+{
+    if (Query >= m_MaxQueries || !m_Active.at(Query) || !SupportsConditionalRendering())
+    {
+        return false;
+    }
+
+    const FrameQueries& Previous = m_Frames.at((m_FrameIndex + Constants::ImageCount - 1U) % Constants::ImageCount);
+
+    const VkConditionalRenderingBeginInfoEXT Info{.sType = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT,
+                                                  .buffer = Previous.Predicates->GetHandle(),
+                                                  .offset = sizeof(std::uint32_t) * Query};
+
+    vkCmdBeginConditionalRenderingEXT(Recorder, &Info);
+    return true;
+}
+
+void luvk::OcclusionQueries::EndConditional(CommandRecorder& Recorder) const
+{
+    vkCmdEndConditionalRenderingEXT(Recorder);
+}
+
+bool luvk::OcclusionQueries::SupportsConditionalRendering() const noexcept
+{
+    return vkCmdBeginConditionalRenderingEXT != nullptr &&
+           m_DeviceModule->GetExtensions().IsExtensionEnabled(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+}
+
+void luvk::OcclusionQueries::ClearResources()
+{
+    const VkDevice LogicalDevice = m_DeviceModule ? m_DeviceModule->GetLogicalDevice() : VK_NULL_HANDLE;
+
+    for (FrameQueries& FrameIt : m_Frames)
+    {
+        if (FrameIt.Pool != VK_NULL_HANDLE && LogicalDevice != VK_NULL_HANDLE)
+        {
+            vkDestroyQueryPool(LogicalDevice, FrameIt.Pool, nullptr);
+        }
+
+        FrameIt = {};
+    }
+
+    m_ProxyPipeline.reset();
+    m_Active.clear();
+    m_PendingReset.clear();
+    m_MaxQueries = 0U;
+}
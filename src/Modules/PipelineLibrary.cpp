@@ -0,0 +1,472 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/PipelineLibrary.hpp"
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include "luvk/Constants/Rendering.hpp"
+#include "luvk/Libraries/Hash.hpp"
+#include "luvk/Libraries/VulkanHelpers.hpp"
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/ThreadPool.hpp"
+#include "luvk/Resources/PipelineCache.hpp"
+
+template <typename Handle, typename Factory, typename Deleter>
+static Handle FindOrCreate(std::mutex&                               Mutex,
+                           std::unordered_map<std::uint64_t, Handle>& Entries,
+                           const std::uint64_t                       Key,
+                           Factory&&                                 Create,
+                           Deleter&&                                 Destroy)
+{
+    {
+        std::lock_guard Lock(Mutex);
+        if (const auto EntryIt = Entries.find(Key);
+            EntryIt != std::end(Entries))
+        {
+            return EntryIt->second;
+        }
+    }
+
+    const Handle NewHandle = Create();
+
+    std::lock_guard Lock(Mutex);
+    if (const auto [EntryIt, Inserted] = Entries.try_emplace(Key, NewHandle);
+        !Inserted)
+    {
+        Destroy(NewHandle);
+        return EntryIt->second;
+    }
+
+    return NewHandle;
+}
+
+static VkPipeline CreateLibrary(const VkDevice                          LogicalDevice,
+                                const VkPipelineCache                   Cache,
+                                const VkGraphicsPipelineLibraryFlagsEXT Parts,
+                                VkGraphicsPipelineCreateInfo            Info)
+{
+    const VkGraphicsPipelineLibraryCreateInfoEXT LibraryInfo{.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+                                                             .flags = Parts};
+
+    Info.pNext  = &LibraryInfo;
+    Info.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+    VkPipeline Library{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreateGraphicsPipelines(LogicalDevice, Cache, 1, &Info, nullptr, &Library)))
+    {
+        throw std::runtime_error("Failed to create graphics pipeline library.");
+    }
+
+    return Library;
+}
+
+static VkPipelineLayout CreateLayout(const VkDevice LogicalDevice, const luvk::Pipeline::CreationArguments& Arguments)
+{
+    const VkPipelineLayoutCreateInfo LayoutInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+                                                .setLayoutCount = static_cast<std::uint32_t>(std::size(Arguments.SetLayouts)),
+                                                .pSetLayouts = std::data(Arguments.SetLayouts),
+                                                .pushConstantRangeCount = static_cast<std::uint32_t>(std::size(Arguments.PushConstants)),
+                                                .pPushConstantRanges = std::data(Arguments.PushConstants)};
+
+    VkPipelineLayout Layout{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreatePipelineLayout(LogicalDevice, &LayoutInfo, nullptr, &Layout)))
+    {
+        throw std::runtime_error("Failed to create pipeline layout.");
+    }
+
+    return Layout;
+}
+
+static VkPipeline CreateVertexInputLibrary(const VkDevice LogicalDevice, const VkPipelineCache Cache, const luvk::Pipeline::CreationArguments& Arguments)
+{
+    const VkPipelineVertexInputStateCreateInfo VertexInput{.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+                                                           .vertexBindingDescriptionCount = static_cast<std::uint32_t>(std::size(Arguments.Bindings)),
+                                                           .pVertexBindingDescriptions = std::data(Arguments.Bindings),
+                                                           .vertexAttributeDescriptionCount = static_cast<std::uint32_t>(std::size(Arguments.Attributes)),
+                                                           .pVertexAttributeDescriptions = std::data(Arguments.Attributes)};
+
+    const VkPipelineInputAssemblyStateCreateInfo InputAssembly{.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+                                                               .topology = Arguments.Topology,
+                                                               .primitiveRestartEnable = VK_FALSE};
+
+    return CreateLibrary(LogicalDevice,
+                         Cache,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                         {.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+                          .pVertexInputState = &VertexInput,
+                          .pInputAssemblyState = &InputAssembly});
+}
+
+static VkPipeline CreatePreRasterLibrary(const VkDevice                           LogicalDevice,
+                                         const VkPipelineCache                    Cache,
+                                         const luvk::Pipeline::CreationArguments& Arguments,
+                                         const VkPipelineLayout                   Layout)
+{
+    const VkShaderModuleCreateInfo VertCode{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+                                            .codeSize = std::size(Arguments.VertexShader) * sizeof(std::uint32_t),
+                                            .pCode = std::data(Arguments.VertexShader)};
+
+    const VkPipelineShaderStageCreateInfo VertStage{.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                                                    .pNext = &VertCode,
+                                                    .flags = 0,
+                                                    .stage = VK_SHADER_STAGE_VERTEX_BIT,
+                                                    .module = VK_NULL_HANDLE,
+                                                    .pName = "main"};
+
+    constexpr VkPipelineViewportStateCreateInfo ViewportState{.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+                                                              .pNext = nullptr,
+                                                              .flags = 0,
+                                                              .viewportCount = 1,
+                                                              .pViewports = nullptr,
+                                                              .scissorCount = 1,
+                                                              .pScissors = nullptr};
+
+    const VkPipelineRasterizationStateCreateInfo Rasterization{.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+                                                               .depthClampEnable = VK_FALSE,
+                                                               .rasterizerDiscardEnable = VK_FALSE,
+                                                               .polygonMode = VK_POLYGON_MODE_FILL,
+                                                               .cullMode = Arguments.CullMode,
+                                                               .frontFace = Arguments.FrontFace,
+                                                               .depthBiasEnable = VK_FALSE,
+                                                               .depthBiasConstantFactor = 0.F,
+                                                               .depthBiasClamp = 0.F,
+                                                               .depthBiasSlopeFactor = 0.F,
+                                                               .lineWidth = 1.F};
+
+    constexpr std::array DynamicStates{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+
+    const VkPipelineDynamicStateCreateInfo Dynamic{.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+                                                   .pNext = nullptr,
+                                                   .flags = 0,
+                                                   .dynamicStateCount = static_cast<std::uint32_t>(std::size(DynamicStates)),
+                                                   .pDynamicStates = std::data(DynamicStates)};
+
+    return CreateLibrary(LogicalDevice,
+                         Cache,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                         {.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+                          .stageCount = 1,
+                          .pStages = &VertStage,
+                          .pViewportState = &ViewportState,
+                          .pRasterizationState = &Rasterization,
+                          .pDynamicState = &Dynamic,
+                          .layout = Layout,
+                          .renderPass = Arguments.RenderPass,
+                          .subpass = Arguments.Subpass});
+}
+
+static VkPipeline CreateFragmentLibrary(const VkDevice                           LogicalDevice,
+                                        const VkPipelineCache                    Cache,
+                                        const luvk::Pipeline::CreationArguments& Arguments,
+                                        const VkPipelineLayout                   Layout)
+{
+    const VkShaderModuleCreateInfo FragCode{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+                                            .codeSize = std::size(Arguments.FragmentShader) * sizeof(std::uint32_t),
+                                            .pCode = std::data(Arguments.FragmentShader)};
+
+    const VkPipelineShaderStageCreateInfo FragStage{.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                                                    .pNext = &FragCode,
+                                                    .flags = 0,
+                                                    .stage = VK_SHADER_STAGE_FRAGMENT_BIT,
+                                                    .module = VK_NULL_HANDLE,
+                                                    .pName = "main"};
+
+    constexpr VkPipelineMultisampleStateCreateInfo Multisample{.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+                                                               .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT};
+
+    const VkPipelineDepthStencilStateCreateInfo DepthStencilState{.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+                                                                  .depthTestEnable = Arguments.EnableDepthOp,
+                                                                  .depthWriteEnable = Arguments.EnableDepthOp && Arguments.EnableDepthWrite,
+                                                                  .depthCompareOp = Arguments.DepthCompareOp,
+                                                                  .depthBoundsTestEnable = VK_FALSE,
+                                                                  .stencilTestEnable = VK_FALSE,
+                                                                  .minDepthBounds = 0.F,
+                                                                  .maxDepthBounds = 1.F};
+
+    return CreateLibrary(LogicalDevice,
+                         Cache,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                         {.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+                          .stageCount = 1,
+                          .pStages = &FragStage,
+                          .pMultisampleState = &Multisample,
+                          .pDepthStencilState = &DepthStencilState,
+                          .layout = Layout,
+                          .renderPass = Arguments.RenderPass,
+                          .subpass = Arguments.Subpass});
+}
+
+static VkPipeline CreateOutputLibrary(const VkDevice LogicalDevice, const VkPipelineCache Cache, const luvk::Pipeline::CreationArguments& Arguments)
+{
+    constexpr VkPipelineMultisampleStateCreateInfo Multisample{.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+                                                               .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT};
+
+    const VkPipelineColorBlendAttachmentState ColorBlendAttachment{.blendEnable = VK_TRUE,
+                                                                   .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
+                                                                   .dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                   .colorBlendOp = VK_BLEND_OP_ADD,
+                                                                   .srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
+                                                                   .dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                   .alphaBlendOp = VK_BLEND_OP_ADD,
+                                                                   .colorWriteMask = Arguments.ColorWriteMask};
+
+    const VkPipelineColorBlendStateCreateInfo ColorBlend{.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+                                                         .attachmentCount = 1,
+                                                         .pAttachments = &ColorBlendAttachment};
+
+    return CreateLibrary(LogicalDevice,
+                         Cache,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+                         {.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+                          .pMultisampleState = &Multisample,
+                          .pColorBlendState = &ColorBlend,
+                          .renderPass = Arguments.RenderPass,
+                          .subpass = Arguments.Subpass});
+}
+
+static VkPipeline LinkLibraries(const VkDevice                    LogicalDevice,
+                                const VkPipelineCache             Cache,
+                                const std::span<const VkPipeline> Libraries,
+                                const VkPipelineLayout            Layout,
+                                const VkPipelineCreateFlags       Flags)
+{
+    const VkPipelineLibraryCreateInfoKHR LinkInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+                                                  .libraryCount = static_cast<std::uint32_t>(std::size(Libraries)),
+                                                  .pLibraries = std::data(Libraries)};
+
+    const VkGraphicsPipelineCreateInfo Info{.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+                                            .pNext = &LinkInfo,
+                                            .flags = Flags,
+                                            .layout = Layout};
+
+    VkPipeline Linked{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreateGraphicsPipelines(LogicalDevice, Cache, 1, &Info, nullptr, &Linked)))
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    return Linked;
+}
+
+luvk::PipelineLibrary::PipelineLibrary(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<ThreadPool>& ThreadPoolModule)
+    : m_DeviceModule(DeviceModule),
+      m_ThreadPool(ThreadPoolModule) {}
+
+const void* luvk::PipelineLibrary::GetDeviceFeatureChain() const noexcept
+{
+    if (m_DeviceModule &&
+        m_DeviceModule->GetExtensions().HasAvailableExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+        m_DeviceModule->GetExtensions().HasAvailableExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+    {
+        return &m_LibraryFeatures;
+    }
+
+    return nullptr;
+}
+
+bool luvk::PipelineLibrary::IsSupported() const noexcept
+{
+    return m_DeviceModule &&
+           m_DeviceModule->GetExtensions().IsExtensionEnabled(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+           m_DeviceModule->GetExtensions().IsExtensionEnabled(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+}
+
+std::shared_ptr<luvk::Pipeline> luvk::PipelineLibrary::CreateGraphicsPipeline(const Pipeline::CreationArguments& Arguments)
+{
+    auto NewPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+
+    if (!IsSupported())
+    {
+        NewPipeline->CreateGraphicsPipeline(Arguments);
+        return NewPipeline;
+    }
+
+    const VkDevice             LogicalDevice = m_DeviceModule->GetLogicalDevice();
+    const PipelineCache* const Cache         = Arguments.Cache;
+
+    const auto DestroyPipeline = [LogicalDevice](const VkPipeline Handle)
+    {
+        vkDestroyPipeline(LogicalDevice, Handle, nullptr);
+    };
+
+    const std::uint64_t LayoutKey      = HashSpan(Arguments.PushConstants, HashSpan(Arguments.SetLayouts, HashSeed));
+    const std::uint64_t PassKey        = HashValue(Arguments.Subpass, HashValue(Arguments.RenderPass, HashSeed));
+    const std::uint64_t VertexInputKey = HashValue(Arguments.Topology, HashSpan(Arguments.Attributes, HashSpan(Arguments.Bindings, HashSeed)));
+    const std::uint64_t PreRasterKey   = HashValue(Arguments.FrontFace, HashValue(Arguments.CullMode, HashValue(LayoutKey, HashSpan(Arguments.VertexShader, PassKey))));
+    const std::uint64_t OutputKey      = HashValue(Arguments.ColorWriteMask, PassKey);
+    const std::uint64_t FragmentKey    = HashValue(Arguments.DepthCompareOp,
+                                                   HashValue(Arguments.EnableDepthWrite,
+                                                             HashValue(Arguments.EnableDepthOp, HashValue(LayoutKey, HashSpan(Arguments.FragmentShader, PassKey)))));
+
+    const VkPipelineLayout Layout = FindOrCreate(m_Mutex,
+                                                 m_Layouts,
+                                                 LayoutKey,
+                                                 [&]
+                                                 {
+                                                     return CreateLayout(LogicalDevice, Arguments);
+                                                 },
+                                                 [LogicalDevice](const VkPipelineLayout Handle)
+                                                 {
+                                                     vkDestroyPipelineLayout(LogicalDevice, Handle, nullptr);
+                                                 });
+
+    const std::array Libraries{FindOrCreate(m_Mutex,
+                                            m_VertexInputLibraries,
+                                            VertexInputKey,
+                                            [&]
+                                            {
+                                                return CreateVertexInputLibrary(LogicalDevice, Cache ? Cache->GetOutputCache() : VK_NULL_HANDLE, Arguments);
+                                            },
+                                            DestroyPipeline),
+                               FindOrCreate(m_Mutex,
+                                            m_PreRasterLibraries,
+                                            PreRasterKey,
+                                            [&]
+                                            {
+                                                return CreatePreRasterLibrary(LogicalDevice, Cache ? Cache->GetPreRasterCache() : VK_NULL_HANDLE, Arguments, Layout);
+                                            },
+                                            DestroyPipeline),
+                               FindOrCreate(m_Mutex,
+                                            m_FragmentLibraries,
+                                            FragmentKey,
+                                            [&]
+                                            {
+                                                return CreateFragmentLibrary(LogicalDevice, Cache ? Cache->GetFragmentCache() : VK_NULL_HANDLE, Arguments, Layout);
+                                            },
+                                            DestroyPipeline),
+                               FindOrCreate(m_Mutex,
+                                            m_OutputLibraries,
+                                            OutputKey,
+                                            [&]
+                                            {
+                                                return CreateOutputLibrary(LogicalDevice, Cache ? Cache->GetOutputCache() : VK_NULL_HANDLE, Arguments);
+                                            },
+                                            DestroyPipeline)};
+
+    const VkPipelineCache CompositeCache = Cache ? Cache->GetCompositeCache() : VK_NULL_HANDLE;
+    const bool            Background     = m_ThreadPool && m_ThreadPool->GetThreadCount() > 0U;
+    const VkPipeline      Linked         = LinkLibraries(LogicalDevice,
+                                                         CompositeCache,
+                                                         Libraries,
+                                                         Layout,
+                                                         Background
+                                                             ? Arguments.Flags
+                                                             : Arguments.Flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+
+    if (Linked == VK_NULL_HANDLE)
+    {
+        throw std::runtime_error("Failed to link graphics pipeline libraries.");
+    }
+
+    NewPipeline->AssignLinkedPipeline(Linked, Layout, Arguments.PushConstants);
+
+    if (Background)
+    {
+        m_ThreadPool->Submit([this, LogicalDevice, CompositeCache, Libraries, Layout, Linked, Flags = Arguments.Flags, Target = std::weak_ptr{NewPipeline}]
+        {
+            if (const VkPipeline Optimized = LinkLibraries(LogicalDevice, CompositeCache, Libraries, Layout, Flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+                Optimized != VK_NULL_HANDLE)
+            {
+                std::lock_guard Lock(m_Mutex);
+                m_Pending.push_back({.Target = Target, .Linked = Linked, .Layout = Layout, .Optimized = Optimized});
+            }
+        });
+    }
+
+    return NewPipeline;
+}
+
+void luvk::PipelineLibrary::Update()
+{
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    std::lock_guard Lock(m_Mutex);
+
+    std::erase_if(m_Retired,
+                  [LogicalDevice](const RetiredPipeline& RetiredIt)
+                  {
+                      if (RetiredIt.FramesLeft > 0U)
+                      {
+                          return false;
+                      }
+
+                      vkDestroyPipeline(LogicalDevice, RetiredIt.Handle, nullptr);
+                      return true;
+                  });
+
+    for (RetiredPipeline& RetiredIt : m_Retired)
+    {
+        --RetiredIt.FramesLeft;
+    }
+
+    for (const PendingPipeline& PendingIt : m_Pending)
+    {
+        if (const std::shared_ptr<Pipeline> Target = PendingIt.Target.lock();
+            Target && Target->CompareExchangePipeline(PendingIt.Linked, PendingIt.Layout, PendingIt.Optimized))
+        {
+            m_Retired.push_back({.Handle = PendingIt.Linked, .FramesLeft = Constants::ImageCount});
+        }
+        else
+        {
+            vkDestroyPipeline(LogicalDevice, PendingIt.Optimized, nullptr);
+        }
+    }
+
+    m_Pending.clear();
+}
+
+std::size_t luvk::PipelineLibrary::GetLibraryCount()
+{
+    std::lock_guard Lock(m_Mutex);
+    return std::size(m_VertexInputLibraries) + std::size(m_PreRasterLibraries) + std::size(m_FragmentLibraries) + std::size(m_OutputLibraries);
+}
+
+void luvk::PipelineLibrary::ClearResources()
+{
+    if (!m_DeviceModule)
+    {
+        return;
+    }
+
+    if (m_ThreadPool)
+    {
+        m_ThreadPool->WaitIdle();
+    }
+
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    std::lock_guard Lock(m_Mutex);
+
+    for (const PendingPipeline& PendingIt : m_Pending)
+    {
+        vkDestroyPipeline(LogicalDevice, PendingIt.Optimized, nullptr);
+    }
+
+    for (const RetiredPipeline& RetiredIt : m_Retired)
+    {
+        vkDestroyPipeline(LogicalDevice, RetiredIt.Handle, nullptr);
+    }
+
+    for (auto* const LibrariesIt : {&m_VertexInputLibraries, &m_PreRasterLibraries, &m_FragmentLibraries, &m_OutputLibraries})
+    {
+        for (const VkPipeline LibraryIt : *LibrariesIt | std::views::values)
+        {
+            vkDestroyPipeline(LogicalDevice, LibraryIt, nullptr);
+        }
+
+        LibrariesIt->clear();
+    }
+
+    for (const VkPipelineLayout LayoutIt : m_Layouts | std::views::values)
+    {
+        vkDestroyPipelineLayout(LogicalDevice, LayoutIt, nullptr);
+    }
+
+    m_Pending.clear();
+    m_Retired.clear();
+    m_Layouts.clear();
+}
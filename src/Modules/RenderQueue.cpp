@@ -0,0 +1,107 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/RenderQueue.hpp"
+#include <array>
+#include <cstring>
+#include <iterator>
+#include "luvk/Types/CommandRecorder.hpp"
+#include "luvk/Types/Mesh.hpp"
+
+static_assert(sizeof(luvk::RenderQueue::Packet) == 16U);
+
+constexpr auto g_RadixBits    = 8U;
+constexpr auto g_RadixBuckets = 1U << g_RadixBits;
+constexpr auto g_RadixPasses  = 64U / g_RadixBits;
+
+void luvk::RenderQueue::Reserve(const std::size_t Count)
+{
+    m_Packets.reserve(Count);
+    m_Scratch.reserve(Count);
+}
+
+void luvk::RenderQueue::Submit(const std::uint64_t Key, const Mesh& Object)
+{
+    m_Packets.push_back(Packet{.Key = Key, .Object = &Object});
+}
+
+void luvk::RenderQueue::Sort()
+{
+    const std::size_t Count = std::size(m_Packets);
+
+    if (Count < 2U)
+    {
+        return;
+    }
+
+    std::array<std::array<std::uint32_t, g_RadixBuckets>, g_RadixPasses> Histograms{};
+
+    for (const Packet& PacketIt : m_Packets)
+    {
+        for (std::uint32_t Digit = 0U; Digit < g_RadixPasses; ++Digit)
+        {
+            ++Histograms[Digit][(PacketIt.Key >> Digit * g_RadixBits) & (g_RadixBuckets - 1U)];
+        }
+    }
+
+    m_Scratch.resize(Count);
+
+    Packet* Source = std::data(m_Packets);
+    Packet* Target = std::data(m_Scratch);
+
+    for (std::uint32_t Digit = 0U; Digit < g_RadixPasses; ++Digit)
+    {
+        std::array<std::uint32_t, g_RadixBuckets>& Histogram = Histograms[Digit];
+        const std::uint32_t                        Shift     = Digit * g_RadixBits;
+
+        if (Histogram[(Source->Key >> Shift) & (g_RadixBuckets - 1U)] == Count)
+        {
+            continue;
+        }
+
+        std::uint32_t Offset = 0U;
+        for (std::uint32_t& BucketIt : Histogram)
+        {
+            const std::uint32_t BucketCount = BucketIt;
+            BucketIt                        = Offset;
+            Offset += BucketCount;
+        }
+
+        for (std::size_t Index = 0U; Index < Count; ++Index)
+        {
+            const Packet& Current = Source[Index];
+            Target[Histogram[(Current.Key >> Shift) & (g_RadixBuckets - 1U)]++] = Current;
+        }
+
+        std::swap(Source, Target);
+    }
+
+    if (Source != std::data(m_Packets))
+    {
+        std::memcpy(std::data(m_Packets), Source, Count * sizeof(Packet));
+    }
+}
+
+void luvk::RenderQueue::Flush(CommandRecorder& Recorder)
+{
+    Sort();
+
+    for (const Packet& PacketIt : m_Packets)
+    {
+        PacketIt.Object->Render(Recorder, m_FrameIndex);
+    }
+
+    Clear();
+}
+
+void luvk::RenderQueue::Clear() noexcept
+{
+    m_Packets.clear();
+}
+
+void luvk::RenderQueue::ClearResources()
+{
+    m_Packets = {};
+    m_Scratch = {};
+}
@@ -110,11 +110,19 @@ bool luvk::Renderer::InitializeRenderer(const InstanceCreationArguments& Argumen
     {
         volkLoadInstance(m_Instance);
 
+        m_FrameModules.clear();
+
         for (const std::shared_ptr<IRenderModule>& Module : AllModules)
         {
             if (Module != nullptr)
             {
                 Module->InitializeResources();
+
+                if (auto FrameModule = std::dynamic_pointer_cast<IFrameModule>(Module);
+                    FrameModule != nullptr)
+                {
+                    m_FrameModules.push_back(std::move(FrameModule));
+                }
             }
         }
 
@@ -127,6 +135,8 @@ bool luvk::Renderer::InitializeRenderer(const InstanceCreationArguments& Argumen
 
 void luvk::Renderer::ClearResources()
 {
+    m_FrameModules.clear();
+
     m_Modules.DebugModule.reset();
     m_Modules.DeviceModule.reset();
     m_Modules.MemoryModule.reset();
@@ -154,8 +164,9 @@ void luvk::Renderer::DrawFrame() const
         return;
     }
 
-    const VkDevice LogicalDevice = m_Modules.DeviceModule->GetLogicalDevice();
-    FrameData&     Frame         = m_Modules.SynchronizationModule->GetFrame(m_Modules.SynchronizationModule->GetCurrentFrame());
+    const VkDevice      LogicalDevice = m_Modules.DeviceModule->GetLogicalDevice();
+    const std::uint32_t FrameIndex    = GetCurrentFrame();
+    FrameData&          Frame         = m_Modules.SynchronizationModule->GetFrame(FrameIndex);
 
     if (Frame.Submitted == true)
     {
@@ -164,6 +175,11 @@ void luvk::Renderer::DrawFrame() const
         Frame.Submitted = false;
     }
 
+    for (const std::shared_ptr<IFrameModule>& ModuleIt : m_FrameModules)
+    {
+        ModuleIt->BeginFrame(FrameIndex);
+    }
+
     std::uint32_t  ImageIndex    = 0U;
     const VkResult AcquireResult = vkAcquireNextImageKHR(LogicalDevice,
                                                          m_Modules.SwapChainModule->GetHandle(),
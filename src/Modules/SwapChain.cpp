@@ -149,11 +149,15 @@ void luvk::SwapChain::CreateRenderPass(const VkDevice LogicalDevice)
                                  VkAttachmentDescription{.format = m_DepthFormat,
                                                          .samples = VK_SAMPLE_COUNT_1_BIT,
                                                          .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                                                         .storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                                         .storeOp = m_Arguments.KeepDepth
+                                                                        ? VK_ATTACHMENT_STORE_OP_STORE
+                                                                        : VK_ATTACHMENT_STORE_OP_DONT_CARE,
                                                          .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
                                                          .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
                                                          .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                                                         .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL}};
+                                                         .finalLayout = m_Arguments.KeepDepth
+                                                                            ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
+                                                                            : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL}};
 
     constexpr std::array AttachmentReferences{VkAttachmentReference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL},
                                               VkAttachmentReference{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL}};
@@ -163,23 +167,32 @@ void luvk::SwapChain::CreateRenderPass(const VkDevice LogicalDevice)
                                  .pColorAttachments = &AttachmentReferences.at(0U),
                                  .pDepthStencilAttachment = &AttachmentReferences.at(1U)};
 
-    VkSubpassDependency SubpassDependency{.srcSubpass = VK_SUBPASS_EXTERNAL,
-                                          .dstSubpass = 0,
-                                          .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
-                                          VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                                          .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
-                                          VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                                          .srcAccessMask = 0,
-                                          .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
-                                          VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT};
+    const VkPipelineStageFlags DepthReaderStage = m_Arguments.KeepDepth ? VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT : 0U;
+
+    const std::array SubpassDependencies{VkSubpassDependency{.srcSubpass = VK_SUBPASS_EXTERNAL,
+                                                             .dstSubpass = 0,
+                                                             .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                                             VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                                                             DepthReaderStage,
+                                                             .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                                             VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                                                             .srcAccessMask = 0,
+                                                             .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                                             VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT},
+                                         VkSubpassDependency{.srcSubpass = 0,
+                                                             .dstSubpass = VK_SUBPASS_EXTERNAL,
+                                                             .srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                                                             .dstStageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                                             .srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                                                             .dstAccessMask = VK_ACCESS_SHADER_READ_BIT}};
 
     const VkRenderPassCreateInfo Info{.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
                                       .attachmentCount = static_cast<std::uint32_t>(std::size(Attachments)),
                                       .pAttachments = std::data(Attachments),
                                       .subpassCount = 1,
                                       .pSubpasses = &Subpass,
-                                      .dependencyCount = 1,
-                                      .pDependencies = &SubpassDependency};
+                                      .dependencyCount = m_Arguments.KeepDepth ? 2U : 1U,
+                                      .pDependencies = std::data(SubpassDependencies)};
 
     LUVK_EXECUTE(vkCreateRenderPass(LogicalDevice, &Info, nullptr, &m_RenderPass));
 }
@@ -240,7 +253,9 @@ void luvk::SwapChain::CreateDepthResources()
 
         DepthImage->CreateImage({.Extent = {m_Arguments.Extent.width, m_Arguments.Extent.height, 1},
                                  .Format = m_DepthFormat,
-                                 .Usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                                 .Usage = m_Arguments.KeepDepth
+                                              ? static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT)
+                                              : static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT),
                                  .Aspect = Aspect,
                                  .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY});
 
@@ -258,6 +273,23 @@ void luvk::SwapChain::DestroyDepthResources()
 
 VkFormat luvk::SwapChain::SelectDepthFormat(const VkPhysicalDevice PhysicalDevice) const
 {
+    if (m_Arguments.KeepDepth)
+    {
+        for (constexpr std::array Candidates{VK_FORMAT_D32_SFLOAT, VK_FORMAT_D16_UNORM};
+             const VkFormat       Format : Candidates)
+        {
+            VkFormatProperties Props{};
+            vkGetPhysicalDeviceFormatProperties(PhysicalDevice, Format, &Props);
+
+            constexpr VkFormatFeatureFlags Required = VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+
+            if ((Props.optimalTilingFeatures & Required) == Required)
+            {
+                return Format;
+            }
+        }
+    }
+
     for (constexpr std::array Candidates{VK_FORMAT_D24_UNORM_S8_UINT, VK_FORMAT_D16_UNORM};
          const VkFormat       Format : Candidates)
     {
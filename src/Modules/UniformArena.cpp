@@ -0,0 +1,72 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Modules/UniformArena.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Resources/Buffer.hpp"
+
+luvk::UniformArena::UniformArena(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<Memory>& MemoryModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule) {}
+
+void luvk::UniformArena::CreateArena(const VkDeviceSize CapacityPerFrame)
+{
+    if (CapacityPerFrame > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::runtime_error("Uniform arena capacity exceeds the dynamic offset range.");
+    }
+
+    m_Alignment = std::max<VkDeviceSize>(1U, m_DeviceModule->GetDeviceProperties().limits.minUniformBufferOffsetAlignment);
+    m_Capacity  = CapacityPerFrame;
+
+    for (std::uint32_t Frame = 0U; Frame < Constants::ImageCount; ++Frame)
+    {
+        std::shared_ptr<Buffer>& Target = m_Buffers.at(Frame);
+
+        Target = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+        Target->CreateBuffer({.Size = m_Capacity,
+                              .Usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                              .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                              .Name = "Uniform Arena"});
+
+        m_Heads.at(Frame).store(0U, std::memory_order_relaxed);
+    }
+}
+
+std::uint32_t luvk::UniformArena::Push(const std::span<const std::byte> Data, const VkDeviceSize Range, const std::uint32_t FrameIndex)
+{
+    if (Data.size_bytes() > Range)
+    {
+        throw std::runtime_error("Uniform data exceeds the bound dynamic uniform range.");
+    }
+
+    const VkDeviceSize Size   = (Data.size_bytes() + m_Alignment - 1U) / m_Alignment * m_Alignment;
+    const VkDeviceSize Offset = m_Heads.at(FrameIndex).fetch_add(Size, std::memory_order_relaxed);
+
+    if (Offset + Range > m_Capacity)
+    {
+        throw std::runtime_error("Uniform arena is out of memory for this frame.");
+    }
+
+    m_Buffers.at(FrameIndex)->Upload(Data, Offset);
+    return static_cast<std::uint32_t>(Offset);
+}
+
+void luvk::UniformArena::BeginFrame(const std::uint32_t FrameIndex)
+{
+    m_Heads.at(FrameIndex).store(0U, std::memory_order_relaxed);
+}
+
+void luvk::UniformArena::ClearResources()
+{
+    for (std::shared_ptr<Buffer>& BufferIt : m_Buffers)
+    {
+        BufferIt.reset();
+    }
+
+    m_Capacity = 0U;
+}
@@ -32,13 +32,30 @@ void luvk::Buffer::CreateBuffer(const CreationArguments& Arguments)
                                   .pNext = nullptr,
                                   .flags = 0,
                                   .size = Arguments.Size,
-                                  .usage = Arguments.Usage,
+                                  .usage = Arguments.PreferDirectWrites ? Arguments.Usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT : Arguments.Usage,
                                   .sharingMode = VK_SHARING_MODE_EXCLUSIVE};
 
-    const VmaAllocationCreateInfo AllocInfo{.flags = Arguments.MemoryUsage == VMA_MEMORY_USAGE_CPU_TO_GPU
-                                                         ? VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT
-                                                         : 0U,
-                                            .usage = Arguments.MemoryUsage,
+    VmaAllocationCreateFlags AllocFlags  = 0U;
+    VmaMemoryUsage           MemoryUsage = Arguments.MemoryUsage;
+
+    if (Arguments.PreferDirectWrites)
+    {
+        AllocFlags = VMA_ALLOCATION_CREATE_MAPPED_BIT |
+                     VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                     VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT;
+        MemoryUsage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+    }
+    else if (Arguments.MemoryUsage == VMA_MEMORY_USAGE_CPU_TO_GPU)
+    {
+        AllocFlags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+    }
+    else if (Arguments.MemoryUsage == VMA_MEMORY_USAGE_GPU_TO_CPU)
+    {
+        AllocFlags = VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+    }
+
+    const VmaAllocationCreateInfo AllocInfo{.flags = AllocFlags,
+                                            .usage = MemoryUsage,
                                             .priority = Arguments.Priority};
 
     VmaAllocationInfo AllocationInfo;
@@ -48,6 +65,23 @@ void luvk::Buffer::CreateBuffer(const CreationArguments& Arguments)
     }
 
     m_Map = AllocationInfo.pMappedData;
+    vmaGetAllocationMemoryProperties(Allocator, m_Allocation, &m_MemoryProperties);
+
+    m_DeviceAddress = 0U;
+
+    if ((Info.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0U && m_DeviceModule->SupportsBufferDeviceAddress())
+    {
+        const VkBufferDeviceAddressInfo AddressInfo{.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, .pNext = nullptr, .buffer = m_Buffer};
+
+        if (vkGetBufferDeviceAddress)
+        {
+            m_DeviceAddress = vkGetBufferDeviceAddress(m_DeviceModule->GetLogicalDevice(), &AddressInfo);
+        }
+        else if (vkGetBufferDeviceAddressKHR)
+        {
+            m_DeviceAddress = vkGetBufferDeviceAddressKHR(m_DeviceModule->GetLogicalDevice(), &AddressInfo);
+        }
+    }
 
     if (!std::empty(Arguments.Name))
     {
@@ -69,22 +103,29 @@ void luvk::Buffer::RecreateBuffer(const CreationArguments& Arguments)
     CreateBuffer(Arguments);
 }
 
-void luvk::Buffer::Upload(const std::span<const std::byte> Data) const
+void luvk::Buffer::Upload(const std::span<const std::byte> Data, const VkDeviceSize Offset) const
 {
     const VmaAllocator Allocator = m_MemoryModule->GetAllocator();
+    const bool         CanFlush  = !(m_MemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-    VkMemoryPropertyFlags MemoryFlags;
-    vmaGetAllocationMemoryProperties(Allocator, m_Allocation, &MemoryFlags);
+    if (Offset + std::size(Data) > m_Size)
+    {
+        throw std::runtime_error("Upload size exceeds buffer capacity.");
+    }
 
-    const bool CanFlush = !(MemoryFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (GetUploadPath() == UploadPath::Staged)
+    {
+        UploadStaged(Data, Offset);
+        return;
+    }
 
     if (m_Map)
     {
-        std::memcpy(m_Map, std::data(Data), std::size(Data));
+        std::memcpy(static_cast<std::byte*>(m_Map) + Offset, std::data(Data), std::size(Data));
 
         if (CanFlush)
         {
-            vmaFlushAllocation(Allocator, m_Allocation, 0, std::size(Data));
+            vmaFlushAllocation(Allocator, m_Allocation, Offset, std::size(Data));
         }
     }
     else
@@ -95,19 +136,104 @@ void luvk::Buffer::Upload(const std::span<const std::byte> Data) const
             throw std::runtime_error("Failed to std::unordered_map buffer memory.");
         }
 
-        if (std::size(Data) > m_Size)
-        {
-            vmaUnmapMemory(Allocator, m_Allocation);
-            throw std::runtime_error("Upload size exceeds buffer capacity.");
-        }
-
-        std::memcpy(Mapping, std::data(Data), std::size(Data));
+        std::memcpy(static_cast<std::byte*>(Mapping) + Offset, std::data(Data), std::size(Data));
 
         if (CanFlush)
         {
-            vmaFlushAllocation(Allocator, m_Allocation, 0, std::size(Data));
+            vmaFlushAllocation(Allocator, m_Allocation, Offset, std::size(Data));
         }
 
         vmaUnmapMemory(Allocator, m_Allocation);
     }
 }
+
+void luvk::Buffer::Upload(const std::shared_ptr<Buffer>& Staging, const VkDeviceSize Offset) const
+{
+    if (!Staging || Offset + Staging->GetSize() > m_Size)
+    {
+        throw std::runtime_error("Staged upload size exceeds buffer capacity.");
+    }
+
+    m_DeviceModule->SubmitImmediate([this, &Staging, Offset](const VkCommandBuffer CommandBuffer)
+    {
+        const VkBufferCopy Region{.srcOffset = 0, .dstOffset = Offset, .size = Staging->GetSize()};
+        vkCmdCopyBuffer(CommandBuffer, Staging->GetHandle(), m_Buffer, 1, &Region);
+
+        const VkBufferMemoryBarrier ToRead{.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                           .pNext = nullptr,
+                                           .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                           .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT,
+                                           .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                           .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                           .buffer = m_Buffer,
+                                           .offset = Offset,
+                                           .size = Staging->GetSize()};
+
+        vkCmdPipelineBarrier(CommandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0,
+                             0,
+                             nullptr,
+                             1,
+                             &ToRead,
+                             0,
+                             nullptr);
+    });
+}
+
+void luvk::Buffer::UploadStaged(const std::span<const std::byte> Data, const VkDeviceSize Offset) const
+{
+    if (GetUploadPath() != UploadPath::Staged)
+    {
+        Upload(Data, Offset);
+        return;
+    }
+
+    const auto Staging = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    Staging->CreateBuffer({.Size = std::size(Data),
+                           .Usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                           .MemoryUsage = VMA_MEMORY_USAGE_CPU_ONLY,
+                           .Name = "Staging"});
+    Staging->Upload(Data);
+
+    Upload(Staging, Offset);
+}
+
+void luvk::Buffer::Flush(const VkDeviceSize Offset, const VkDeviceSize Size) const
+{
+    if (!LUVK_EXECUTE(vmaFlushAllocation(m_MemoryModule->GetAllocator(), m_Allocation, Offset, Size)))
+    {
+        throw std::runtime_error("Failed to flush buffer memory.");
+    }
+}
+
+void luvk::Buffer::Download(const std::span<std::byte> Data, const VkDeviceSize Offset) const
+{
+    const VmaAllocator Allocator = m_MemoryModule->GetAllocator();
+
+    if (Offset + std::size(Data) > m_Size)
+    {
+        throw std::runtime_error("Download size exceeds buffer capacity.");
+    }
+
+    if (!LUVK_EXECUTE(vmaInvalidateAllocation(Allocator, m_Allocation, Offset, std::size(Data))))
+    {
+        throw std::runtime_error("Failed to invalidate buffer memory.");
+    }
+
+    if (m_Map)
+    {
+        std::memcpy(std::data(Data), static_cast<const std::byte*>(m_Map) + Offset, std::size(Data));
+        return;
+    }
+
+    void* Mapping = nullptr;
+    if (!LUVK_EXECUTE(vmaMapMemory(Allocator, m_Allocation, &Mapping)))
+    {
+        throw std::runtime_error("Failed to map buffer memory.");
+    }
+
+    std::memcpy(std::data(Data), static_cast<const std::byte*>(Mapping) + Offset, std::size(Data));
+    vmaUnmapMemory(Allocator, m_Allocation);
+}
@@ -3,12 +3,70 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Resources/DescriptorSet.hpp"
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include "luvk/Libraries/VulkanHelpers.hpp"
 #include "luvk/Modules/DescriptorPool.hpp"
 #include "luvk/Modules/Device.hpp"
 #include "luvk/Modules/Memory.hpp"
 
+static constexpr bool IsBufferDescriptor(const VkDescriptorType Type)
+{
+    switch (Type)
+    {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static constexpr bool IsImageDescriptor(const VkDescriptorType Type)
+{
+    switch (Type)
+    {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool BuildTemplateEntries(const std::span<const VkDescriptorSetLayoutBinding> Bindings,
+                                 const std::span<const std::uint32_t>                FirstSlots,
+                                 std::vector<VkDescriptorUpdateTemplateEntry>&       Entries)
+{
+    Entries.clear();
+    Entries.reserve(std::size(Bindings));
+
+    for (std::size_t Index = 0U; Index < std::size(Bindings); ++Index)
+    {
+        const VkDescriptorSetLayoutBinding& Binding = Bindings[Index];
+
+        if (!IsBufferDescriptor(Binding.descriptorType) && !IsImageDescriptor(Binding.descriptorType))
+        {
+            return false;
+        }
+
+        Entries.push_back(VkDescriptorUpdateTemplateEntry{.dstBinding = Binding.binding,
+                                                          .dstArrayElement = 0,
+                                                          .descriptorCount = Binding.descriptorCount,
+                                                          .descriptorType = Binding.descriptorType,
+                                                          .offset = FirstSlots[Index] * sizeof(luvk::DescriptorSet::DescriptorData),
+                                                          .stride = sizeof(luvk::DescriptorSet::DescriptorData)});
+    }
+
+    return !std::empty(Entries);
+}
+
 luvk::DescriptorSet::DescriptorSet(const std::shared_ptr<Device>&         DeviceModule,
                                    const std::shared_ptr<DescriptorPool>& PoolModule,
                                    const std::shared_ptr<Memory>&         MemoryModule)
@@ -22,10 +80,13 @@ luvk::DescriptorSet::~DescriptorSet()
 
     if (m_Set != VK_NULL_HANDLE && m_PoolModule)
     {
-        vkFreeDescriptorSets(LogicalDevice, m_PoolModule->GetHandle(), 1, &m_Set);
-        m_Set = VK_NULL_HANDLE;
+        m_PoolModule->Free(m_Pool, m_Set);
+        m_Set  = VK_NULL_HANDLE;
+        m_Pool = VK_NULL_HANDLE;
     }
 
+    DestroyUpdateTemplate();
+
     if (m_Layout != VK_NULL_HANDLE && m_OwnsLayout)
     {
         vkDestroyDescriptorSetLayout(LogicalDevice, m_Layout, nullptr);
@@ -35,11 +96,19 @@ luvk::DescriptorSet::~DescriptorSet()
 
 void luvk::DescriptorSet::CreateLayout(const LayoutInfo& Info)
 {
-    m_OwnsLayout = true;
+    if (Info.PushDescriptor && !m_DeviceModule->SupportsPushDescriptors())
+    {
+        throw std::runtime_error("Push descriptors are not supported by the device.");
+    }
+
+    m_OwnsLayout     = true;
+    m_PushDescriptor = Info.PushDescriptor;
 
     const VkDescriptorSetLayoutCreateInfo CreateInfo{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
                                                      .pNext = nullptr,
-                                                     .flags = 0,
+                                                     .flags = m_PushDescriptor
+                                                                  ? static_cast<VkDescriptorSetLayoutCreateFlags>(VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+                                                                  : 0U,
                                                      .bindingCount = static_cast<std::uint32_t>(std::size(Info.Bindings)),
                                                      .pBindings = std::data(Info.Bindings)};
 
@@ -47,59 +116,398 @@ void luvk::DescriptorSet::CreateLayout(const LayoutInfo& Info)
     {
         throw std::runtime_error("Failed to create descriptor set layout.");
     }
+
+    ResetSlots(Info.Bindings);
+    CreateUpdateTemplate();
 }
 
 void luvk::DescriptorSet::UseLayout(const VkDescriptorSetLayout Layout)
 {
-    m_Layout     = Layout;
-    m_OwnsLayout = false;
+    UseLayout(Layout, {});
+}
+
+void luvk::DescriptorSet::UseLayout(const VkDescriptorSetLayout Layout, const std::span<const VkDescriptorSetLayoutBinding> Bindings)
+{
+    DestroyUpdateTemplate();
+
+    m_Layout         = Layout;
+    m_OwnsLayout     = false;
+    m_PushDescriptor = false;
+
+    ResetSlots(Bindings);
+    CreateUpdateTemplate();
 }
 
 void luvk::DescriptorSet::Allocate()
 {
-    const VkDescriptorSetAllocateInfo AllocateInfo{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-                                                   .descriptorPool = m_PoolModule->GetHandle(),
-                                                   .descriptorSetCount = 1,
-                                                   .pSetLayouts = &m_Layout};
+    if (m_PushDescriptor)
+    {
+        throw std::runtime_error("Push descriptor layouts cannot be allocated from a pool.");
+    }
+
+    if (m_Set != VK_NULL_HANDLE)
+    {
+        m_PoolModule->Free(m_Pool, m_Set);
+    }
+
+    m_Pool = m_PoolModule->Allocate(m_Layout, m_Set);
+    InvalidateSlots();
+}
+
+void luvk::DescriptorSet::AllocateTransient(const std::uint32_t FrameIndex)
+{
+    if (m_PushDescriptor)
+    {
+        throw std::runtime_error("Push descriptor layouts cannot be allocated from a pool.");
+    }
 
-    if (!LUVK_EXECUTE(vkAllocateDescriptorSets(m_DeviceModule->GetLogicalDevice(), &AllocateInfo, &m_Set)))
+    if (m_Set != VK_NULL_HANDLE && m_Pool != VK_NULL_HANDLE)
     {
-        throw std::runtime_error("Failed to allocate descriptor set.");
+        m_PoolModule->Free(m_Pool, m_Set);
     }
+
+    m_Pool = VK_NULL_HANDLE;
+    m_Set  = m_PoolModule->AllocateTransient(m_Layout, FrameIndex);
+    InvalidateSlots();
 }
 
 void luvk::DescriptorSet::UpdateBuffer(const VkBuffer         Buffer,
                                        const VkDeviceSize     Size,
                                        const std::uint32_t    Binding,
-                                       const VkDescriptorType Type) const
+                                       const VkDescriptorType Type,
+                                       const VkDeviceSize     Offset,
+                                       const std::uint32_t    ArrayElement)
 {
-    const VkDescriptorBufferInfo BufferInfo{.buffer = Buffer, .offset = 0, .range = Size};
-
-    const VkWriteDescriptorSet Write{.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                                     .dstSet = m_Set,
-                                     .dstBinding = Binding,
-                                     .descriptorCount = 1,
-                                     .descriptorType = Type,
-                                     .pBufferInfo = &BufferInfo};
+    const std::uint32_t Slot = FindSlot(Binding, Type, ArrayElement);
+    const DescriptorData Data{.Buffer = {.buffer = Buffer, .offset = Offset, .range = Size}};
 
-    vkUpdateDescriptorSets(m_DeviceModule->GetLogicalDevice(), 1, &Write, 0, nullptr);
+    const VkDescriptorBufferInfo& Current = m_Data.at(Slot).Buffer;
+    StoreSlot(Slot, Data, Current.buffer == Buffer && Current.offset == Offset && Current.range == Size);
 }
 
 void luvk::DescriptorSet::UpdateImage(const VkImageView      View,
                                       const VkSampler        Sampler,
                                       const std::uint32_t    Binding,
-                                      const VkDescriptorType Type) const
+                                      const VkDescriptorType Type,
+                                      const VkImageLayout    Layout,
+                                      const std::uint32_t    ArrayElement)
+{
+    const std::uint32_t Slot = FindSlot(Binding, Type, ArrayElement);
+    const DescriptorData Data{.Image = {.sampler = Sampler, .imageView = View, .imageLayout = Layout}};
+
+    const VkDescriptorImageInfo& Current = m_Data.at(Slot).Image;
+    StoreSlot(Slot, Data, Current.sampler == Sampler && Current.imageView == View && Current.imageLayout == Layout);
+}
+
+void luvk::DescriptorSet::Flush()
+{
+    if (std::empty(m_DirtySlots) || m_Set == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    if (m_Template != VK_NULL_HANDLE && AreAllSlotsWritten())
+    {
+        vkUpdateDescriptorSetWithTemplate(LogicalDevice, m_Set, m_Template, std::data(m_Data));
+    }
+    else
+    {
+        const std::vector<VkWriteDescriptorSet> Writes = BuildWrites(m_DirtySlots);
+        vkUpdateDescriptorSets(LogicalDevice, static_cast<std::uint32_t>(std::size(Writes)), std::data(Writes), 0, nullptr);
+    }
+
+    for (const std::uint32_t SlotIt : m_DirtySlots)
+    {
+        m_SlotStates.at(SlotIt) &= static_cast<std::uint8_t>(~SlotDirty);
+    }
+
+    m_DirtySlots.clear();
+}
+
+void luvk::DescriptorSet::Push(const VkCommandBuffer     CommandBuffer,
+                               const VkPipelineBindPoint BindPoint,
+                               const VkPipelineLayout    PipelineLayout,
+                               const std::uint32_t       SetIndex)
+{
+    if (!m_PushDescriptor)
+    {
+        throw std::runtime_error("Descriptor set layout was not created for push descriptors.");
+    }
+
+    const auto PushWithTemplate = vkCmdPushDescriptorSetWithTemplateKHR != nullptr
+                                      ? vkCmdPushDescriptorSetWithTemplateKHR
+                                      : vkCmdPushDescriptorSetWithTemplate;
+
+    if (PushWithTemplate != nullptr && SupportsUpdateTemplates() && AreAllSlotsWritten())
+    {
+        if (m_PushTemplate == VK_NULL_HANDLE ||
+            m_PushTemplateLayout != PipelineLayout ||
+            m_PushTemplateBindPoint != BindPoint ||
+            m_PushTemplateSet != SetIndex)
+        {
+            CreatePushTemplate(BindPoint, PipelineLayout, SetIndex);
+        }
+
+        if (m_PushTemplate != VK_NULL_HANDLE)
+        {
+            PushWithTemplate(CommandBuffer, m_PushTemplate, PipelineLayout, SetIndex, std::data(m_Data));
+
+            std::ranges::fill(m_SlotStates, static_cast<std::uint8_t>(SlotWritten));
+            m_DirtySlots.clear();
+            return;
+        }
+    }
+
+    std::vector<std::uint32_t> WrittenSlots{};
+    WrittenSlots.reserve(std::size(m_SlotStates));
+
+    for (std::uint32_t Slot = 0U; Slot < static_cast<std::uint32_t>(std::size(m_SlotStates)); ++Slot)
+    {
+        if ((m_SlotStates.at(Slot) & SlotWritten) != 0U)
+        {
+            m_SlotStates.at(Slot) = SlotWritten;
+            WrittenSlots.push_back(Slot);
+        }
+    }
+
+    m_DirtySlots.clear();
+
+    if (std::empty(WrittenSlots))
+    {
+        return;
+    }
+
+    const auto PushSet = vkCmdPushDescriptorSetKHR != nullptr ? vkCmdPushDescriptorSetKHR : vkCmdPushDescriptorSet;
+    const std::vector<VkWriteDescriptorSet> Writes = BuildWrites(WrittenSlots);
+
+    PushSet(CommandBuffer, BindPoint, PipelineLayout, SetIndex, static_cast<std::uint32_t>(std::size(Writes)), std::data(Writes));
+}
+
+std::uint32_t luvk::DescriptorSet::FindSlot(const std::uint32_t Binding, const VkDescriptorType Type, const std::uint32_t ArrayElement)
+{
+    const auto BindingIt = std::ranges::find_if(m_Bindings,
+                                                [Binding](const VkDescriptorSetLayoutBinding& BindingIt)
+                                                {
+                                                    return BindingIt.binding == Binding;
+                                                });
+
+    if (BindingIt != std::end(m_Bindings))
+    {
+        if (BindingIt->descriptorType != Type)
+        {
+            throw std::runtime_error("Descriptor type does not match the layout binding.");
+        }
+
+        if (ArrayElement >= BindingIt->descriptorCount)
+        {
+            throw std::runtime_error("Descriptor array element is out of the layout binding range.");
+        }
+
+        return m_FirstSlots.at(static_cast<std::size_t>(std::distance(std::begin(m_Bindings), BindingIt))) + ArrayElement;
+    }
+
+    if (!IsBufferDescriptor(Type) && !IsImageDescriptor(Type))
+    {
+        throw std::runtime_error("Unsupported descriptor type.");
+    }
+
+    if (ArrayElement != 0U)
+    {
+        throw std::runtime_error("Descriptor arrays require the layout bindings to be known.");
+    }
+
+    DestroyUpdateTemplate();
+
+    m_Bindings.push_back(VkDescriptorSetLayoutBinding{.binding = Binding, .descriptorType = Type, .descriptorCount = 1});
+    m_FirstSlots.push_back(static_cast<std::uint32_t>(std::size(m_Data)));
+    m_Data.push_back(DescriptorData{});
+    m_SlotStates.push_back(0U);
+
+    return m_FirstSlots.back();
+}
+
+void luvk::DescriptorSet::StoreSlot(const std::uint32_t Slot, const DescriptorData& Data, const bool Equal)
 {
-    const VkDescriptorImageInfo ImageInfo{.sampler = Sampler,
-                                          .imageView = View,
-                                          .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    std::uint8_t& State = m_SlotStates.at(Slot);
+
+    if (Equal && (State & SlotWritten) != 0U)
+    {
+        return;
+    }
+
+    m_Data.at(Slot) = Data;
+
+    if ((State & SlotDirty) == 0U)
+    {
+        m_DirtySlots.push_back(Slot);
+    }
+
+    State = SlotWritten | SlotDirty;
+}
+
+void luvk::DescriptorSet::ResetSlots(const std::span<const VkDescriptorSetLayoutBinding> Bindings)
+{
+    m_Bindings.clear();
+    m_FirstSlots.clear();
+
+    std::uint32_t SlotCount = 0U;
+
+    for (const VkDescriptorSetLayoutBinding& BindingIt : Bindings)
+    {
+        if (BindingIt.descriptorCount > 0U)
+        {
+            m_Bindings.push_back(BindingIt);
+            m_FirstSlots.push_back(SlotCount);
+            SlotCount += BindingIt.descriptorCount;
+        }
+    }
+
+    m_Data.assign(SlotCount, DescriptorData{});
+    m_SlotStates.assign(SlotCount, 0U);
+    m_DirtySlots.clear();
+}
+
+void luvk::DescriptorSet::InvalidateSlots()
+{
+    m_DirtySlots.clear();
+
+    for (std::uint32_t Slot = 0U; Slot < static_cast<std::uint32_t>(std::size(m_SlotStates)); ++Slot)
+    {
+        std::uint8_t& State = m_SlotStates.at(Slot);
+
+        if ((State & SlotWritten) != 0U)
+        {
+            State |= SlotDirty;
+            m_DirtySlots.push_back(Slot);
+        }
+    }
+}
+
+void luvk::DescriptorSet::CreateUpdateTemplate()
+{
+    if (m_PushDescriptor || m_Layout == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    if (!SupportsUpdateTemplates())
+    {
+        return;
+    }
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries{};
+    if (!BuildTemplateEntries(m_Bindings, m_FirstSlots, Entries))
+    {
+        return;
+    }
 
-    const VkWriteDescriptorSet Write{.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                                     .dstSet = m_Set,
-                                     .dstBinding = Binding,
-                                     .descriptorCount = 1,
-                                     .descriptorType = Type,
-                                     .pImageInfo = &ImageInfo};
+    const VkDescriptorUpdateTemplateCreateInfo CreateInfo{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+                                                          .descriptorUpdateEntryCount = static_cast<std::uint32_t>(std::size(Entries)),
+                                                          .pDescriptorUpdateEntries = std::data(Entries),
+                                                          .templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,
+                                                          .descriptorSetLayout = m_Layout};
+
+    if (!LUVK_EXECUTE(vkCreateDescriptorUpdateTemplate(m_DeviceModule->GetLogicalDevice(), &CreateInfo, nullptr, &m_Template)))
+    {
+        m_Template = VK_NULL_HANDLE;
+    }
+}
+
+void luvk::DescriptorSet::DestroyUpdateTemplate()
+{
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    if (m_Template != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorUpdateTemplate(LogicalDevice, m_Template, nullptr);
+        m_Template = VK_NULL_HANDLE;
+    }
+
+    if (m_PushTemplate != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorUpdateTemplate(LogicalDevice, m_PushTemplate, nullptr);
+        m_PushTemplate       = VK_NULL_HANDLE;
+        m_PushTemplateLayout = VK_NULL_HANDLE;
+    }
+}
+
+void luvk::DescriptorSet::CreatePushTemplate(const VkPipelineBindPoint BindPoint, const VkPipelineLayout PipelineLayout, const std::uint32_t SetIndex)
+{
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    if (m_PushTemplate != VK_NULL_HANDLE)
+    {
+        vkDestroyDescriptorUpdateTemplate(LogicalDevice, m_PushTemplate, nullptr);
+        m_PushTemplate = VK_NULL_HANDLE;
+    }
+
+    m_PushTemplateLayout    = PipelineLayout;
+    m_PushTemplateBindPoint = BindPoint;
+    m_PushTemplateSet       = SetIndex;
+
+    if (!SupportsUpdateTemplates())
+    {
+        return;
+    }
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries{};
+    if (!BuildTemplateEntries(m_Bindings, m_FirstSlots, Entries))
+    {
+        return;
+    }
+
+    const VkDescriptorUpdateTemplateCreateInfo CreateInfo{.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,
+                                                          .descriptorUpdateEntryCount = static_cast<std::uint32_t>(std::size(Entries)),
+                                                          .pDescriptorUpdateEntries = std::data(Entries),
+                                                          .templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR,
+                                                          .descriptorSetLayout = m_Layout,
+                                                          .pipelineBindPoint = BindPoint,
+                                                          .pipelineLayout = PipelineLayout,
+                                                          .set = SetIndex};
+
+    if (!LUVK_EXECUTE(vkCreateDescriptorUpdateTemplate(LogicalDevice, &CreateInfo, nullptr, &m_PushTemplate)))
+    {
+        m_PushTemplate = VK_NULL_HANDLE;
+    }
+}
+
+bool luvk::DescriptorSet::SupportsUpdateTemplates() const noexcept
+{
+    return vkCreateDescriptorUpdateTemplate != nullptr && m_DeviceModule->GetEffectiveApiVersion() >= VK_API_VERSION_1_1;
+}
+
+bool luvk::DescriptorSet::AreAllSlotsWritten() const noexcept
+{
+    return std::ranges::all_of(m_SlotStates,
+                               [](const std::uint8_t State)
+                               {
+                                   return (State & SlotWritten) != 0U;
+                               });
+}
+
+std::vector<VkWriteDescriptorSet> luvk::DescriptorSet::BuildWrites(const std::span<const std::uint32_t> Slots) const
+{
+    std::vector<VkWriteDescriptorSet> Writes{};
+    Writes.reserve(std::size(Slots));
+
+    for (const std::uint32_t SlotIt : Slots)
+    {
+        const auto                          FirstIt = std::ranges::upper_bound(m_FirstSlots, SlotIt) - 1;
+        const VkDescriptorSetLayoutBinding& Binding = m_Bindings.at(static_cast<std::size_t>(std::distance(std::begin(m_FirstSlots), FirstIt)));
+        const DescriptorData&               Data    = m_Data.at(SlotIt);
+        const bool                          IsImage = IsImageDescriptor(Binding.descriptorType);
+
+        Writes.push_back(VkWriteDescriptorSet{.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                              .dstSet = m_Set,
+                                              .dstBinding = Binding.binding,
+                                              .dstArrayElement = SlotIt - *FirstIt,
+                                              .descriptorCount = 1,
+                                              .descriptorType = Binding.descriptorType,
+                                              .pImageInfo = IsImage ? &Data.Image : nullptr,
+                                              .pBufferInfo = IsImage ? nullptr : &Data.Buffer});
+    }
 
-    vkUpdateDescriptorSets(m_DeviceModule->GetLogicalDevice(), 1, &Write, 0, nullptr);
+    return Writes;
 }
@@ -0,0 +1,72 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Resources/GeometryBuffer.hpp"
+#include <stdexcept>
+#include "luvk/Resources/Buffer.hpp"
+
+luvk::GeometryBuffer::GeometryBuffer(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<Memory>& MemoryModule)
+    : m_DeviceModule(DeviceModule),
+      m_MemoryModule(MemoryModule) {}
+
+void luvk::GeometryBuffer::CreateGeometryBuffer(const CreationArguments& Arguments)
+{
+    if (Arguments.VertexStride == 0U || Arguments.MaxVertices == 0U || Arguments.MaxIndices == 0U)
+    {
+        throw std::runtime_error("Invalid geometry buffer dimensions.");
+    }
+
+    m_VertexStride = Arguments.VertexStride;
+    m_MaxVertices  = Arguments.MaxVertices;
+    m_MaxIndices   = Arguments.MaxIndices;
+
+    m_VertexBuffer = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    m_VertexBuffer->CreateBuffer({.Size = m_VertexStride * m_MaxVertices,
+                                  .Usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                  .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                  .Name = Arguments.Name + " VTX"});
+
+    m_IndexBuffer = std::make_shared<Buffer>(m_DeviceModule, m_MemoryModule);
+    m_IndexBuffer->CreateBuffer({.Size = sizeof(std::uint32_t) * m_MaxIndices,
+                                 .Usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                 .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                                 .Name = Arguments.Name + " IDX"});
+
+    Reset();
+}
+
+luvk::GeometryBuffer::Range luvk::GeometryBuffer::Append(const std::span<const std::byte> Vertices, const std::span<const std::uint32_t> Indices)
+{
+    if (Vertices.size_bytes() % m_VertexStride != 0U)
+    {
+        throw std::runtime_error("Vertex data is not a multiple of the geometry buffer stride.");
+    }
+
+    const auto NumVertices = static_cast<std::uint32_t>(Vertices.size_bytes() / m_VertexStride);
+    const auto NumIndices  = static_cast<std::uint32_t>(std::size(Indices));
+
+    if (m_VertexCount + NumVertices > m_MaxVertices || m_IndexCount + NumIndices > m_MaxIndices)
+    {
+        throw std::runtime_error("Geometry buffer is out of memory.");
+    }
+
+    const Range Output{.FirstIndex = m_IndexCount,
+                       .IndexCount = NumIndices,
+                       .VertexOffset = static_cast<std::int32_t>(m_VertexCount),
+                       .VertexCount = NumVertices};
+
+    m_VertexBuffer->Upload(Vertices, m_VertexCount * m_VertexStride);
+    m_IndexBuffer->Upload(std::as_bytes(Indices), m_IndexCount * sizeof(std::uint32_t));
+
+    m_VertexCount += NumVertices;
+    m_IndexCount += NumIndices;
+
+    return Output;
+}
+
+void luvk::GeometryBuffer::Reset() noexcept
+{
+    m_VertexCount = 0U;
+    m_IndexCount  = 0U;
+}
@@ -3,6 +3,7 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Resources/Image.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <iterator>
@@ -22,6 +23,13 @@ luvk::Image::~Image()
     const VmaAllocator Allocator = m_MemoryModule->GetAllocator();
     const VkDevice     Device    = m_DeviceModule->GetLogicalDevice();
 
+    for (const VkImageView MipViewIt : m_MipViews)
+    {
+        vkDestroyImageView(Device, MipViewIt, nullptr);
+    }
+
+    m_MipViews.clear();
+
     if (m_View != VK_NULL_HANDLE)
     {
         vkDestroyImageView(Device, m_View, nullptr);
@@ -38,8 +46,9 @@ luvk::Image::~Image()
 
 void luvk::Image::CreateImage(const CreationArguments& Arguments)
 {
-    m_Width  = Arguments.Extent.width;
-    m_Height = Arguments.Extent.height;
+    m_Width     = Arguments.Extent.width;
+    m_Height    = Arguments.Extent.height;
+    m_MipLevels = std::max(Arguments.MipLevels, 1U);
 
     const VmaAllocator Allocator = m_MemoryModule->GetAllocator();
 
@@ -49,7 +58,7 @@ void luvk::Image::CreateImage(const CreationArguments& Arguments)
                                  .imageType = VK_IMAGE_TYPE_2D,
                                  .format = Arguments.Format,
                                  .extent = Arguments.Extent,
-                                 .mipLevels = 1,
+                                 .mipLevels = m_MipLevels,
                                  .arrayLayers = 1,
                                  .samples = VK_SAMPLE_COUNT_1_BIT,
                                  .tiling = Tiling,
@@ -72,12 +81,33 @@ void luvk::Image::CreateImage(const CreationArguments& Arguments)
                                          .image = m_Image,
                                          .viewType = VK_IMAGE_VIEW_TYPE_2D,
                                          .format = Arguments.Format,
-                                         .subresourceRange = {Arguments.Aspect, 0, 1, 0, 1}};
+                                         .subresourceRange = {Arguments.Aspect, 0, m_MipLevels, 0, 1}};
 
     if (!LUVK_EXECUTE(vkCreateImageView(m_DeviceModule->GetLogicalDevice(), &ViewInfo, nullptr, &m_View)))
     {
         throw std::runtime_error("Failed to create image view.");
     }
+
+    if (!Arguments.CreateMipViews)
+    {
+        return;
+    }
+
+    m_MipViews.resize(m_MipLevels, VK_NULL_HANDLE);
+
+    for (std::uint32_t Level = 0U; Level < m_MipLevels; ++Level)
+    {
+        const VkImageViewCreateInfo MipViewInfo{.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                                                .image = m_Image,
+                                                .viewType = VK_IMAGE_VIEW_TYPE_2D,
+                                                .format = Arguments.Format,
+                                                .subresourceRange = {Arguments.Aspect, Level, 1, 0, 1}};
+
+        if (!LUVK_EXECUTE(vkCreateImageView(m_DeviceModule->GetLogicalDevice(), &MipViewInfo, nullptr, &m_MipViews.at(Level))))
+        {
+            throw std::runtime_error("Failed to create image mip view.");
+        }
+    }
 }
 
 void luvk::Image::Upload(const std::span<const std::byte> Data) const
@@ -95,121 +125,64 @@ void luvk::Image::Upload(const std::span<const std::byte> Data) const
 
 void luvk::Image::Upload(const std::shared_ptr<Buffer>& Staging) const
 {
-    const VkDevice      LogicalDevice = m_DeviceModule->GetLogicalDevice();
-    const std::uint32_t QueueFamily   = m_DeviceModule->FindQueueFamilyIndex(VK_QUEUE_GRAPHICS_BIT).value();
-    const VkQueue       Queue         = m_DeviceModule->GetQueue(QueueFamily);
-
-    const VkCommandPoolCreateInfo PoolInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-                                           .pNext = nullptr,
-                                           .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
-                                           .queueFamilyIndex = QueueFamily};
-
-    VkCommandPool Pool{VK_NULL_HANDLE};
-
-    if (!LUVK_EXECUTE(vkCreateCommandPool(LogicalDevice, &PoolInfo, nullptr, &Pool)))
-    {
-        throw std::runtime_error("Failed to create command pool for image upload");
-    }
-
-    const VkCommandBufferAllocateInfo AllocationInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-                                                     .pNext = nullptr,
-                                                     .commandPool = Pool,
-                                                     .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-                                                     .commandBufferCount = 1};
-
-    VkCommandBuffer CommandBuffer{VK_NULL_HANDLE};
-
-    if (!LUVK_EXECUTE(vkAllocateCommandBuffers(LogicalDevice, &AllocationInfo, &CommandBuffer)))
+    m_DeviceModule->SubmitImmediate([this, &Staging](const VkCommandBuffer CommandBuffer)
     {
-        vkDestroyCommandPool(LogicalDevice, Pool, nullptr);
-        throw std::runtime_error("Failed to allocate command buffer for image upload");
-    }
-
-    constexpr VkCommandBufferBeginInfo CommandBufferBeginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-                                                              .pNext = nullptr,
-                                                              .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
-                                                              .pInheritanceInfo = nullptr};
-    vkBeginCommandBuffer(CommandBuffer, &CommandBufferBeginInfo);
-
-    const VkImageMemoryBarrier ToTransfer{.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
-                                          .pNext = nullptr,
-                                          .srcAccessMask = 0,
-                                          .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-                                          .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                                          .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                          .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                                          .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                                          .image = m_Image,
-                                          .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
-
-    vkCmdPipelineBarrier(CommandBuffer,
-                         VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                         VK_PIPELINE_STAGE_TRANSFER_BIT,
-                         0,
-                         0,
-                         nullptr,
-                         0,
-                         nullptr,
-                         1,
-                         &ToTransfer);
-
-    const VkBufferImageCopy Region{.bufferOffset = 0,
-                                   .bufferRowLength = 0,
-                                   .bufferImageHeight = 0,
-                                   .imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
-                                   .imageOffset = {0, 0, 0},
-                                   .imageExtent = {m_Width, m_Height, 1}};
-
-    vkCmdCopyBufferToImage(CommandBuffer,
-                           Staging->GetHandle(),
-                           m_Image,
-                           VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                           1,
-                           &Region);
-
-    const VkImageMemoryBarrier ToShaderRead{.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
-                                            .pNext = nullptr,
-                                            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
-                                            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
-                                            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                            .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-                                            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                                            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                                            .image = m_Image,
-                                            .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
-
-    vkCmdPipelineBarrier(CommandBuffer,
-                         VK_PIPELINE_STAGE_TRANSFER_BIT,
-                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                         0,
-                         0,
-                         nullptr,
-                         0,
-                         nullptr,
-                         1,
-                         &ToShaderRead);
-
-    vkEndCommandBuffer(CommandBuffer);
-
-    const VkSubmitInfo QueueSubmitInfo{.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-                                       .pNext = nullptr,
-                                       .waitSemaphoreCount = 0,
-                                       .pWaitSemaphores = nullptr,
-                                       .pWaitDstStageMask = nullptr,
-                                       .commandBufferCount = 1,
-                                       .pCommandBuffers = &CommandBuffer,
-                                       .signalSemaphoreCount = 0,
-                                       .pSignalSemaphores = nullptr};
-
-    if (!LUVK_EXECUTE(vkQueueSubmit(Queue, 1, &QueueSubmitInfo, VK_NULL_HANDLE)))
-    {
-        vkFreeCommandBuffers(LogicalDevice, Pool, 1, &CommandBuffer);
-        vkDestroyCommandPool(LogicalDevice, Pool, nullptr);
-        throw std::runtime_error("Failed to submit image upload command");
-    }
-
-    vkQueueWaitIdle(Queue);
-
-    vkFreeCommandBuffers(LogicalDevice, Pool, 1, &CommandBuffer);
-    vkDestroyCommandPool(LogicalDevice, Pool, nullptr);
+        const VkImageMemoryBarrier ToTransfer{.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                              .pNext = nullptr,
+                                              .srcAccessMask = 0,
+                                              .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                              .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                                              .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                              .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                              .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                              .image = m_Image,
+                                              .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
+
+        vkCmdPipelineBarrier(CommandBuffer,
+                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0,
+                             0,
+                             nullptr,
+                             0,
+                             nullptr,
+                             1,
+                             &ToTransfer);
+
+        const VkBufferImageCopy Region{.bufferOffset = 0,
+                                       .bufferRowLength = 0,
+                                       .bufferImageHeight = 0,
+                                       .imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},
+                                       .imageOffset = {0, 0, 0},
+                                       .imageExtent = {m_Width, m_Height, 1}};
+
+        vkCmdCopyBufferToImage(CommandBuffer,
+                               Staging->GetHandle(),
+                               m_Image,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               1,
+                               &Region);
+
+        const VkImageMemoryBarrier ToShaderRead{.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                                                .pNext = nullptr,
+                                                .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+                                                .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                                .newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                                                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                                                .image = m_Image,
+                                                .subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
+
+        vkCmdPipelineBarrier(CommandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0,
+                             0,
+                             nullptr,
+                             0,
+                             nullptr,
+                             1,
+                             &ToShaderRead);
+    });
 }
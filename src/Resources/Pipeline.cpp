@@ -6,12 +6,19 @@
 #include <array>
 #include <iterator>
 #include <stdexcept>
+#include <utility>
 #include "luvk/Libraries/VulkanHelpers.hpp"
 #include "luvk/Modules/Device.hpp"
 #include "luvk/Resources/PipelineCache.hpp"
+#include "luvk/Resources/ShaderModuleCache.hpp"
 
-static VkShaderModule CreateShader(const VkDevice Device, std::span<const std::uint32_t> Code)
+static VkShaderModule AcquireShader(const VkDevice Device, luvk::ShaderModuleCache* const Modules, std::span<const std::uint32_t> Code)
 {
+    if (Modules)
+    {
+        return Modules->Acquire(Code);
+    }
+
     const VkShaderModuleCreateInfo Info{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
                                         .codeSize = std::size(Code) * sizeof(std::uint32_t),
                                         .pCode = std::data(Code)};
@@ -25,6 +32,14 @@ static VkShaderModule CreateShader(const VkDevice Device, std::span<const std::u
     return Module;
 }
 
+static void ReleaseShader(const VkDevice Device, const luvk::ShaderModuleCache* const Modules, const VkShaderModule Module)
+{
+    if (!Modules && Module != VK_NULL_HANDLE)
+    {
+        vkDestroyShaderModule(Device, Module, nullptr);
+    }
+}
+
 luvk::Pipeline::Pipeline(const std::shared_ptr<Device>& DeviceModule)
     : m_DeviceModule(DeviceModule) {}
 
@@ -38,8 +53,8 @@ void luvk::Pipeline::CreateGraphicsPipeline(const CreationArguments& Arguments)
     m_Type                       = Type::Graphics;
     const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
 
-    VkShaderModule VertModule = CreateShader(LogicalDevice, Arguments.VertexShader);
-    VkShaderModule FragModule = CreateShader(LogicalDevice, Arguments.FragmentShader);
+    VkShaderModule VertModule = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.VertexShader);
+    VkShaderModule FragModule = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.FragmentShader);
 
     const VkPipelineShaderStageCreateInfo VertStage{.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
                                                     .pNext = nullptr,
@@ -88,17 +103,14 @@ void luvk::Pipeline::CreateGraphicsPipeline(const CreationArguments& Arguments)
     constexpr VkPipelineMultisampleStateCreateInfo Multisample{.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
                                                                .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT};
 
-    constexpr VkPipelineColorBlendAttachmentState ColorBlendAttachment{.blendEnable = VK_TRUE,
-                                                                       .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
-                                                                       .dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
-                                                                       .colorBlendOp = VK_BLEND_OP_ADD,
-                                                                       .srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
-                                                                       .dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
-                                                                       .alphaBlendOp = VK_BLEND_OP_ADD,
-                                                                       .colorWriteMask = VK_COLOR_COMPONENT_R_BIT |
-                                                                       VK_COLOR_COMPONENT_G_BIT |
-                                                                       VK_COLOR_COMPONENT_B_BIT |
-                                                                       VK_COLOR_COMPONENT_A_BIT};
+    const VkPipelineColorBlendAttachmentState ColorBlendAttachment{.blendEnable = VK_TRUE,
+                                                                   .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
+                                                                   .dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                   .colorBlendOp = VK_BLEND_OP_ADD,
+                                                                   .srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
+                                                                   .dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                   .alphaBlendOp = VK_BLEND_OP_ADD,
+                                                                   .colorWriteMask = Arguments.ColorWriteMask};
 
     const VkPipelineColorBlendStateCreateInfo ColorBlend{.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
                                                          .attachmentCount = 1,
@@ -112,7 +124,7 @@ void luvk::Pipeline::CreateGraphicsPipeline(const CreationArguments& Arguments)
                                                    .dynamicStateCount = static_cast<std::uint32_t>(std::size(DynamicStates)),
                                                    .pDynamicStates = std::data(DynamicStates)};
 
-    m_PushConstants.assign(std::begin(Arguments.PushConstants), std::end(Arguments.PushConstants));
+    StorePushConstants(Arguments.PushConstants);
 
     const VkPipelineLayoutCreateInfo LayoutInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
                                                 .setLayoutCount = static_cast<std::uint32_t>(std::size(Arguments.SetLayouts)),
@@ -122,24 +134,29 @@ void luvk::Pipeline::CreateGraphicsPipeline(const CreationArguments& Arguments)
 
     if (!LUVK_EXECUTE(vkCreatePipelineLayout(LogicalDevice, &LayoutInfo, nullptr, &m_PipelineLayout)))
     {
-        vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-        vkDestroyShaderModule(LogicalDevice, VertModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+        ReleaseShader(LogicalDevice, Arguments.Modules, VertModule);
         throw std::runtime_error("Failed to create pipeline layout.");
     }
 
     const VkPipelineDepthStencilStateCreateInfo DepthStencilState{.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
                                                                   .depthTestEnable = Arguments.EnableDepthOp,
-                                                                  .depthWriteEnable = Arguments.EnableDepthOp,
-                                                                  .depthCompareOp = VK_COMPARE_OP_LESS,
+                                                                  .depthWriteEnable = Arguments.EnableDepthOp && Arguments.EnableDepthWrite,
+                                                                  .depthCompareOp = Arguments.DepthCompareOp,
                                                                   .depthBoundsTestEnable = VK_FALSE,
                                                                   .stencilTestEnable = VK_FALSE,
                                                                   .minDepthBounds = 0.F,
                                                                   .maxDepthBounds = 1.F};
 
+    VkPipelineCreationFeedback                 Feedback{};
+    const VkPipelineCreationFeedbackCreateInfo FeedbackInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+                                                            .pPipelineCreationFeedback = &Feedback};
+    const bool                                 TrackFeedback = Arguments.Cache && m_DeviceModule->SupportsPipelineCreationFeedback();
+
     const std::array             Stages{VertStage, FragStage};
     VkGraphicsPipelineCreateInfo PipelineInfo{.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-                                              .pNext = nullptr,
-                                              .flags = 0,
+                                              .pNext = TrackFeedback ? &FeedbackInfo : nullptr,
+                                              .flags = Arguments.Flags,
                                               .stageCount = static_cast<std::uint32_t>(std::size(Stages)),
                                               .pStages = std::data(Stages),
                                               .pVertexInputState = &VertexInput,
@@ -160,13 +177,18 @@ void luvk::Pipeline::CreateGraphicsPipeline(const CreationArguments& Arguments)
                                              : VK_NULL_HANDLE;
         !LUVK_EXECUTE(vkCreateGraphicsPipelines(LogicalDevice, CompositeCache, 1, &PipelineInfo, nullptr, &m_Pipeline)))
     {
-        vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-        vkDestroyShaderModule(LogicalDevice, VertModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+        ReleaseShader(LogicalDevice, Arguments.Modules, VertModule);
         throw std::runtime_error("Failed to create graphics pipeline.");
     }
 
-    vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-    vkDestroyShaderModule(LogicalDevice, VertModule, nullptr);
+    if (TrackFeedback)
+    {
+        Arguments.Cache->RecordFeedback(Feedback);
+    }
+
+    ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+    ReleaseShader(LogicalDevice, Arguments.Modules, VertModule);
 }
 
 void luvk::Pipeline::RecreateGraphicsPipeline(const CreationArguments& Arguments)
@@ -180,7 +202,7 @@ void luvk::Pipeline::CreateComputePipeline(const ComputeCreationArguments& Argum
     m_Type = Type::Compute;
 
     const VkDevice       LogicalDevice = m_DeviceModule->GetLogicalDevice();
-    const VkShaderModule CompModule    = CreateShader(LogicalDevice, Arguments.ComputeShader);
+    const VkShaderModule CompModule    = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.ComputeShader);
 
     const VkPipelineShaderStageCreateInfo CompStage{.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
                                                     .pNext = nullptr,
@@ -189,7 +211,7 @@ void luvk::Pipeline::CreateComputePipeline(const ComputeCreationArguments& Argum
                                                     .module = CompModule,
                                                     .pName = "main"};
 
-    m_PushConstants.assign(std::begin(Arguments.PushConstants), std::end(Arguments.PushConstants));
+    StorePushConstants(Arguments.PushConstants);
 
     const VkPipelineLayoutCreateInfo LayoutInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
                                                 .setLayoutCount = static_cast<std::uint32_t>(std::size(Arguments.SetLayouts)),
@@ -199,12 +221,17 @@ void luvk::Pipeline::CreateComputePipeline(const ComputeCreationArguments& Argum
 
     if (!LUVK_EXECUTE(vkCreatePipelineLayout(LogicalDevice, &LayoutInfo, nullptr, &m_PipelineLayout)))
     {
-        vkDestroyShaderModule(LogicalDevice, CompModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, CompModule);
         throw std::runtime_error("Failed to create pipeline layout.");
     }
 
+    VkPipelineCreationFeedback                 Feedback{};
+    const VkPipelineCreationFeedbackCreateInfo FeedbackInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+                                                            .pPipelineCreationFeedback = &Feedback};
+    const bool                                 TrackFeedback = Arguments.Cache && m_DeviceModule->SupportsPipelineCreationFeedback();
+
     const VkComputePipelineCreateInfo PipelineInfo{.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
-                                                   .pNext = nullptr,
+                                                   .pNext = TrackFeedback ? &FeedbackInfo : nullptr,
                                                    .flags = Arguments.Flags,
                                                    .stage = CompStage,
                                                    .layout = m_PipelineLayout};
@@ -214,11 +241,16 @@ void luvk::Pipeline::CreateComputePipeline(const ComputeCreationArguments& Argum
                                                    : VK_NULL_HANDLE;
         !LUVK_EXECUTE(vkCreateComputePipelines(LogicalDevice, CompositeCache, 1, &PipelineInfo, nullptr, &m_Pipeline)))
     {
-        vkDestroyShaderModule(LogicalDevice, CompModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, CompModule);
         throw std::runtime_error("Failed to create compute pipeline.");
     }
 
-    vkDestroyShaderModule(LogicalDevice, CompModule, nullptr);
+    if (TrackFeedback)
+    {
+        Arguments.Cache->RecordFeedback(Feedback);
+    }
+
+    ReleaseShader(LogicalDevice, Arguments.Modules, CompModule);
 }
 
 void luvk::Pipeline::RecreateComputePipeline(const ComputeCreationArguments& Arguments)
@@ -232,18 +264,18 @@ void luvk::Pipeline::CreateMeshPipeline(const MeshCreationArguments& Arguments)
     m_Type                       = Type::Mesh;
     const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
 
-    VkShaderModule MeshModule = CreateShader(LogicalDevice, Arguments.MeshShader);
+    VkShaderModule MeshModule = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.MeshShader);
     VkShaderModule TaskModule = VK_NULL_HANDLE;
     VkShaderModule FragModule = VK_NULL_HANDLE;
 
     if (!std::empty(Arguments.TaskShader))
     {
-        TaskModule = CreateShader(LogicalDevice, Arguments.TaskShader);
+        TaskModule = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.TaskShader);
     }
 
     if (!std::empty(Arguments.FragmentShader))
     {
-        FragModule = CreateShader(LogicalDevice, Arguments.FragmentShader);
+        FragModule = AcquireShader(LogicalDevice, Arguments.Modules, Arguments.FragmentShader);
     }
 
     std::vector<VkPipelineShaderStageCreateInfo> Stages{};
@@ -321,7 +353,7 @@ void luvk::Pipeline::CreateMeshPipeline(const MeshCreationArguments& Arguments)
                                                    .dynamicStateCount = static_cast<std::uint32_t>(std::size(DynamicStates)),
                                                    .pDynamicStates = std::data(DynamicStates)};
 
-    m_PushConstants.assign(std::begin(Arguments.PushConstants), std::end(Arguments.PushConstants));
+    StorePushConstants(Arguments.PushConstants);
 
     const VkPipelineLayoutCreateInfo LayoutInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
                                                 .setLayoutCount = static_cast<std::uint32_t>(std::size(Arguments.SetLayouts)),
@@ -331,15 +363,9 @@ void luvk::Pipeline::CreateMeshPipeline(const MeshCreationArguments& Arguments)
 
     if (!LUVK_EXECUTE(vkCreatePipelineLayout(LogicalDevice, &LayoutInfo, nullptr, &m_PipelineLayout)))
     {
-        if (FragModule != VK_NULL_HANDLE)
-        {
-            vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-        }
-        if (TaskModule != VK_NULL_HANDLE)
-        {
-            vkDestroyShaderModule(LogicalDevice, TaskModule, nullptr);
-        }
-        vkDestroyShaderModule(LogicalDevice, MeshModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+        ReleaseShader(LogicalDevice, Arguments.Modules, TaskModule);
+        ReleaseShader(LogicalDevice, Arguments.Modules, MeshModule);
         throw std::runtime_error("Failed to create pipeline layout.");
     }
 
@@ -352,8 +378,13 @@ void luvk::Pipeline::CreateMeshPipeline(const MeshCreationArguments& Arguments)
                                                                   .minDepthBounds = 0.F,
                                                                   .maxDepthBounds = 1.F};
 
+    VkPipelineCreationFeedback                 Feedback{};
+    const VkPipelineCreationFeedbackCreateInfo FeedbackInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+                                                            .pPipelineCreationFeedback = &Feedback};
+    const bool                                 TrackFeedback = Arguments.Cache && m_DeviceModule->SupportsPipelineCreationFeedback();
+
     VkGraphicsPipelineCreateInfo PipelineInfo{.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-                                              .pNext = nullptr,
+                                              .pNext = TrackFeedback ? &FeedbackInfo : nullptr,
                                               .flags = Arguments.Flags,
                                               .stageCount = static_cast<std::uint32_t>(std::size(Stages)),
                                               .pStages = std::data(Stages),
@@ -375,30 +406,23 @@ void luvk::Pipeline::CreateMeshPipeline(const MeshCreationArguments& Arguments)
                                              : VK_NULL_HANDLE;
         !LUVK_EXECUTE(vkCreateGraphicsPipelines(LogicalDevice, CompositeCache, 1, &PipelineInfo, nullptr, &m_Pipeline)))
     {
-        if (FragModule != VK_NULL_HANDLE)
-        {
-            vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-        }
-        if (TaskModule != VK_NULL_HANDLE)
-        {
-            vkDestroyShaderModule(LogicalDevice, TaskModule, nullptr);
-        }
+        ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+        ReleaseShader(LogicalDevice, Arguments.Modules, TaskModule);
 
-        vkDestroyShaderModule(LogicalDevice, MeshModule, nullptr);
+        ReleaseShader(LogicalDevice, Arguments.Modules, MeshModule);
 
         throw std::runtime_error("Failed to create mesh pipeline.");
     }
 
-    if (FragModule != VK_NULL_HANDLE)
+    if (TrackFeedback)
     {
-        vkDestroyShaderModule(LogicalDevice, FragModule, nullptr);
-    }
-    if (TaskModule != VK_NULL_HANDLE)
-    {
-        vkDestroyShaderModule(LogicalDevice, TaskModule, nullptr);
+        Arguments.Cache->RecordFeedback(Feedback);
     }
 
-    vkDestroyShaderModule(LogicalDevice, MeshModule, nullptr);
+    ReleaseShader(LogicalDevice, Arguments.Modules, FragModule);
+    ReleaseShader(LogicalDevice, Arguments.Modules, TaskModule);
+
+    ReleaseShader(LogicalDevice, Arguments.Modules, MeshModule);
 }
 
 void luvk::Pipeline::RecreateMeshPipeline(const MeshCreationArguments& Arguments)
@@ -407,6 +431,29 @@ void luvk::Pipeline::RecreateMeshPipeline(const MeshCreationArguments& Arguments
     CreateMeshPipeline(Arguments);
 }
 
+void luvk::Pipeline::AssignLinkedPipeline(const VkPipeline LinkedPipeline, const VkPipelineLayout SharedLayout, const std::span<const VkPushConstantRange> PushConstants)
+{
+    Clear();
+
+    m_Type           = Type::Graphics;
+    m_Pipeline       = LinkedPipeline;
+    m_PipelineLayout = SharedLayout;
+    m_OwnsLayout     = false;
+
+    StorePushConstants(PushConstants);
+}
+
+bool luvk::Pipeline::CompareExchangePipeline(const VkPipeline Expected, const VkPipelineLayout ExpectedLayout, const VkPipeline NewPipeline) noexcept
+{
+    if (m_Pipeline != Expected || m_PipelineLayout != ExpectedLayout)
+    {
+        return false;
+    }
+
+    m_Pipeline = NewPipeline;
+    return true;
+}
+
 void luvk::Pipeline::Clear()
 {
     if (!m_DeviceModule)
@@ -424,8 +471,33 @@ void luvk::Pipeline::Clear()
 
     if (m_PipelineLayout != VK_NULL_HANDLE)
     {
-        vkDestroyPipelineLayout(LogicalDevice, m_PipelineLayout, nullptr);
+        if (m_OwnsLayout)
+        {
+            vkDestroyPipelineLayout(LogicalDevice, m_PipelineLayout, nullptr);
+        }
         m_PipelineLayout = VK_NULL_HANDLE;
     }
+    m_OwnsLayout = true;
     m_PushConstants.clear();
+    m_PushConstantStages = 0U;
+}
+
+void luvk::Pipeline::StorePushConstants(const std::span<const VkPushConstantRange> Ranges)
+{
+    m_PushConstants.assign(std::begin(Ranges), std::end(Ranges));
+    m_PushConstantStages = 0U;
+
+    for (const VkPushConstantRange& RangeIt : m_PushConstants)
+    {
+        m_PushConstantStages |= RangeIt.stageFlags;
+    }
+
+    if (m_PushConstantStages == 0U)
+    {
+        m_PushConstantStages = m_Type == Type::Compute
+                                   ? VK_SHADER_STAGE_COMPUTE_BIT
+                                   : m_Type == Type::Mesh
+                                         ? VK_SHADER_STAGE_MESH_BIT_EXT
+                                         : VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    }
 }
@@ -0,0 +1,134 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Resources/PipelineBatch.hpp"
+#include <exception>
+#include <iterator>
+#include <utility>
+#include "luvk/Modules/ThreadPool.hpp"
+#include "luvk/Resources/ShaderModuleCache.hpp"
+
+struct ArgumentStorage
+{
+    std::vector<std::shared_ptr<const void>> Blocks{};
+
+    template <typename Type>
+    void Own(std::span<const Type>& Data)
+    {
+        if (std::empty(Data))
+        {
+            return;
+        }
+
+        auto Copy = std::make_shared<const std::vector<Type>>(std::begin(Data), std::end(Data));
+        Data      = *Copy;
+        Blocks.push_back(std::move(Copy));
+    }
+};
+
+static void OwnSpans(luvk::Pipeline::CreationArguments& Arguments, ArgumentStorage& Storage)
+{
+    Storage.Own(Arguments.ColorFormats);
+    Storage.Own(Arguments.VertexShader);
+    Storage.Own(Arguments.FragmentShader);
+    Storage.Own(Arguments.SetLayouts);
+    Storage.Own(Arguments.Bindings);
+    Storage.Own(Arguments.Attributes);
+    Storage.Own(Arguments.PushConstants);
+}
+
+static void OwnSpans(luvk::Pipeline::ComputeCreationArguments& Arguments, ArgumentStorage& Storage)
+{
+    Storage.Own(Arguments.ComputeShader);
+    Storage.Own(Arguments.SetLayouts);
+    Storage.Own(Arguments.PushConstants);
+}
+
+static void OwnSpans(luvk::Pipeline::MeshCreationArguments& Arguments, ArgumentStorage& Storage)
+{
+    Storage.Own(Arguments.ColorFormats);
+    Storage.Own(Arguments.TaskShader);
+    Storage.Own(Arguments.MeshShader);
+    Storage.Own(Arguments.FragmentShader);
+    Storage.Own(Arguments.SetLayouts);
+    Storage.Own(Arguments.PushConstants);
+}
+
+template <typename ArgumentsType>
+static std::vector<std::future<std::shared_ptr<luvk::Pipeline>>> DispatchPipelines(const std::shared_ptr<luvk::Device>&            DeviceModule,
+                                                                                   const std::shared_ptr<luvk::ThreadPool>&        ThreadPoolModule,
+                                                                                   const std::shared_ptr<luvk::ShaderModuleCache>& Modules,
+                                                                                   const std::span<const ArgumentsType>            Arguments,
+                                                                                   void (luvk::Pipeline::*Create)(const ArgumentsType&))
+{
+    std::vector<std::future<std::shared_ptr<luvk::Pipeline>>> Futures{};
+    Futures.reserve(std::size(Arguments));
+
+    const bool Parallel = ThreadPoolModule && ThreadPoolModule->GetThreadCount() > 0U && std::size(Arguments) > 1U;
+
+    for (const ArgumentsType& ArgumentsIt : Arguments)
+    {
+        ArgumentsType TaskArguments = ArgumentsIt;
+        if (!TaskArguments.Modules)
+        {
+            TaskArguments.Modules = Modules.get();
+        }
+
+        auto Storage = std::make_shared<ArgumentStorage>();
+        OwnSpans(TaskArguments, *Storage);
+
+        auto Promise = std::make_shared<std::promise<std::shared_ptr<luvk::Pipeline>>>();
+        Futures.push_back(Promise->get_future());
+
+        auto Task = [DeviceModule, Modules, Promise, Storage, TaskArguments, Create]
+        {
+            try
+            {
+                auto NewPipeline = std::make_shared<luvk::Pipeline>(DeviceModule);
+                ((*NewPipeline).*Create)(TaskArguments);
+                Promise->set_value(std::move(NewPipeline));
+            }
+            catch (...)
+            {
+                Promise->set_exception(std::current_exception());
+            }
+        };
+
+        if (Parallel)
+        {
+            ThreadPoolModule->Submit(std::move(Task));
+        }
+        else
+        {
+            Task();
+        }
+    }
+
+    return Futures;
+}
+
+luvk::PipelineBatch::PipelineBatch(const std::shared_ptr<Device>& DeviceModule, const std::shared_ptr<ThreadPool>& ThreadPoolModule)
+    : m_Modules(std::make_shared<ShaderModuleCache>(DeviceModule)),
+      m_ThreadPool(ThreadPoolModule),
+      m_DeviceModule(DeviceModule) {}
+
+std::vector<std::future<std::shared_ptr<luvk::Pipeline>>> luvk::PipelineBatch::CreateGraphicsPipelines(const std::span<const Pipeline::CreationArguments> Arguments) const
+{
+    return DispatchPipelines(m_DeviceModule, m_ThreadPool, m_Modules, Arguments, &Pipeline::CreateGraphicsPipeline);
+}
+
+std::vector<std::future<std::shared_ptr<luvk::Pipeline>>> luvk::PipelineBatch::CreateComputePipelines(const std::span<const Pipeline::ComputeCreationArguments> Arguments) const
+{
+    return DispatchPipelines(m_DeviceModule, m_ThreadPool, m_Modules, Arguments, &Pipeline::CreateComputePipeline);
+}
+
+std::vector<std::future<std::shared_ptr<luvk::Pipeline>>> luvk::PipelineBatch::CreateMeshPipelines(const std::span<const Pipeline::MeshCreationArguments> Arguments) const
+{
+    return DispatchPipelines(m_DeviceModule, m_ThreadPool, m_Modules, Arguments, &Pipeline::CreateMeshPipeline);
+}
+
+void luvk::PipelineBatch::ReleaseShaderModules() const
+{
+    m_Modules->Clear();
+}
@@ -3,17 +3,166 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Resources/PipelineCache.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <span>
 #include <stdexcept>
+#include "luvk/Libraries/Hash.hpp"
 #include "luvk/Libraries/VulkanHelpers.hpp"
 #include "luvk/Modules/Device.hpp"
 
 using namespace luvk;
 
+constexpr std::uint32_t g_CacheFileMagic   = 0x4B56554CU;
+constexpr std::uint32_t g_CacheFileVersion = 1U;
+constexpr std::size_t   g_CacheCount       = 4U;
+
+struct CacheFileHeader
+{
+    std::uint32_t                           Magic{g_CacheFileMagic};
+    std::uint32_t                           Version{g_CacheFileVersion};
+    std::uint32_t                           VendorID{0};
+    std::uint32_t                           DeviceID{0};
+    std::uint32_t                           DriverVersion{0};
+    std::uint32_t                           Reserved{0};
+    std::array<std::uint8_t, VK_UUID_SIZE>  CacheUUID{};
+    std::array<std::uint64_t, g_CacheCount> Sizes{};
+    std::uint64_t                           Checksum{0};
+};
+
+static std::vector<std::byte> ReadCacheFile(const std::filesystem::path& Path)
+{
+    std::ifstream File(Path, std::ios::binary | std::ios::ate);
+    if (!File)
+    {
+        return {};
+    }
+
+    const std::streamsize Size = File.tellg();
+    if (Size <= 0)
+    {
+        return {};
+    }
+
+    std::vector<std::byte> Data(static_cast<std::size_t>(Size));
+    File.seekg(0);
+
+    if (!File.read(reinterpret_cast<char*>(std::data(Data)), Size))
+    {
+        return {};
+    }
+
+    return Data;
+}
+
+static bool IsBlobCompatible(const std::span<const std::byte> Blob, const VkPhysicalDeviceProperties& Properties) noexcept
+{
+    if (std::empty(Blob))
+    {
+        return true;
+    }
+
+    VkPipelineCacheHeaderVersionOne Header{};
+    if (std::size(Blob) < sizeof(Header))
+    {
+        return false;
+    }
+
+    std::memcpy(&Header, std::data(Blob), sizeof(Header));
+
+    return Header.headerSize >= sizeof(Header) &&
+           Header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           Header.vendorID == Properties.vendorID &&
+           Header.deviceID == Properties.deviceID &&
+           std::memcmp(Header.pipelineCacheUUID, Properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static std::array<std::span<const std::byte>, g_CacheCount> ParseCacheFile(const std::span<const std::byte> Data, const VkPhysicalDeviceProperties& Properties)
+{
+    CacheFileHeader Header{};
+    if (std::size(Data) < sizeof(Header))
+    {
+        return {};
+    }
+
+    std::memcpy(&Header, std::data(Data), sizeof(Header));
+
+    if (Header.Magic != g_CacheFileMagic ||
+        Header.Version != g_CacheFileVersion ||
+        Header.VendorID != Properties.vendorID ||
+        Header.DeviceID != Properties.deviceID ||
+        Header.DriverVersion != Properties.driverVersion ||
+        std::memcmp(std::data(Header.CacheUUID), Properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        return {};
+    }
+
+    std::array<std::span<const std::byte>, g_CacheCount> Blobs{};
+    std::uint64_t                                        Checksum = HashSeed;
+    std::size_t                                          Offset   = sizeof(Header);
+
+    for (std::size_t CacheIndex = 0U; CacheIndex < g_CacheCount; ++CacheIndex)
+    {
+        const std::uint64_t BlobSize = Header.Sizes.at(CacheIndex);
+        if (BlobSize > std::size(Data) - Offset)
+        {
+            return {};
+        }
+
+        const std::span Blob = Data.subspan(Offset, static_cast<std::size_t>(BlobSize));
+        if (!IsBlobCompatible(Blob, Properties))
+        {
+            return {};
+        }
+
+        Checksum             = HashBytes(Blob, Checksum);
+        Blobs.at(CacheIndex) = Blob;
+        Offset              += static_cast<std::size_t>(BlobSize);
+    }
+
+    if (Offset != std::size(Data) || Checksum != Header.Checksum)
+    {
+        return {};
+    }
+
+    return Blobs;
+}
+
+static bool GetCacheData(const VkDevice LogicalDevice, const VkPipelineCache Cache, std::vector<std::byte>& Data)
+{
+    VkResult Result = VK_INCOMPLETE;
+
+    while (Result == VK_INCOMPLETE)
+    {
+        std::size_t Size = 0U;
+        if (!LUVK_EXECUTE(vkGetPipelineCacheData(LogicalDevice, Cache, &Size, nullptr)))
+        {
+            return false;
+        }
+
+        Data.resize(Size);
+        Result = vkGetPipelineCacheData(LogicalDevice, Cache, &Size, std::data(Data));
+        Data.resize(Size);
+    }
+
+    return LUVK_EXECUTE(Result);
+}
+
 PipelineCache::PipelineCache(const std::shared_ptr<Device>& DeviceModule)
     : m_DeviceModule(DeviceModule) {}
 
 PipelineCache::~PipelineCache()
 {
+    if (!std::empty(m_Path))
+    {
+        Save();
+    }
+
+    MergeWorkerCaches();
+
     const VkDevice Device = m_DeviceModule->GetLogicalDevice();
     if (m_PreRaster != VK_NULL_HANDLE)
     {
@@ -37,17 +186,171 @@ PipelineCache::~PipelineCache()
     }
 }
 
-void PipelineCache::Create()
+void PipelineCache::Create(const std::filesystem::path& Path)
 {
     const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
 
-    constexpr VkPipelineCacheCreateInfo info{.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+    m_Path   = Path;
+    m_Loaded = false;
 
-    if (!LUVK_EXECUTE(vkCreatePipelineCache(LogicalDevice, &info, nullptr, &m_PreRaster)) ||
-        !LUVK_EXECUTE(vkCreatePipelineCache(LogicalDevice, &info, nullptr, &m_Fragment)) ||
-        !LUVK_EXECUTE(vkCreatePipelineCache(LogicalDevice, &info, nullptr, &m_Output)) ||
-        !LUVK_EXECUTE(vkCreatePipelineCache(LogicalDevice, &info, nullptr, &m_Composite)))
+    std::vector<std::byte>                               FileData{};
+    std::array<std::span<const std::byte>, g_CacheCount> Blobs{};
+
+    if (!std::empty(m_Path))
+    {
+        FileData = ReadCacheFile(m_Path);
+        Blobs    = ParseCacheFile(FileData, m_DeviceModule->GetDeviceProperties());
+        m_Loaded = std::ranges::any_of(Blobs,
+                                       [](const std::span<const std::byte> Blob)
+                                       {
+                                           return !std::empty(Blob);
+                                       });
+    }
+
+    const std::array Targets{&m_PreRaster, &m_Fragment, &m_Output, &m_Composite};
+
+    for (std::size_t CacheIndex = 0U; CacheIndex < g_CacheCount; ++CacheIndex)
     {
-        throw std::runtime_error("Failed to create pipeline caches");
+        const std::span<const std::byte> Blob = Blobs.at(CacheIndex);
+
+        const VkPipelineCacheCreateInfo Info{.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                                             .initialDataSize = std::size(Blob),
+                                             .pInitialData = std::data(Blob)};
+
+        if (!LUVK_EXECUTE(vkCreatePipelineCache(LogicalDevice, &Info, nullptr, Targets.at(CacheIndex))))
+        {
+            throw std::runtime_error("Failed to create pipeline caches");
+        }
     }
 }
+
+bool PipelineCache::Save()
+{
+    return !std::empty(m_Path) && Save(m_Path);
+}
+
+bool PipelineCache::Save(const std::filesystem::path& Path)
+{
+    MergeWorkerCaches();
+
+    const VkDevice                    LogicalDevice = m_DeviceModule->GetLogicalDevice();
+    const VkPhysicalDeviceProperties& Properties    = m_DeviceModule->GetDeviceProperties();
+
+    CacheFileHeader Header{.VendorID = Properties.vendorID, .DeviceID = Properties.deviceID, .DriverVersion = Properties.driverVersion};
+    std::memcpy(std::data(Header.CacheUUID), Properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    const std::array                                 Sources{m_PreRaster, m_Fragment, m_Output, m_Composite};
+    std::array<std::vector<std::byte>, g_CacheCount> Blobs{};
+    Header.Checksum = HashSeed;
+
+    for (std::size_t CacheIndex = 0U; CacheIndex < g_CacheCount; ++CacheIndex)
+    {
+        if (Sources.at(CacheIndex) != VK_NULL_HANDLE && !GetCacheData(LogicalDevice, Sources.at(CacheIndex), Blobs.at(CacheIndex)))
+        {
+            return false;
+        }
+
+        Header.Sizes.at(CacheIndex) = std::size(Blobs.at(CacheIndex));
+        Header.Checksum             = HashBytes(Blobs.at(CacheIndex), Header.Checksum);
+    }
+
+    std::error_code Error;
+    if (Path.has_parent_path())
+    {
+        std::filesystem::create_directories(Path.parent_path(), Error);
+    }
+
+    std::filesystem::path TemporaryPath = Path;
+    TemporaryPath += ".tmp";
+
+    {
+        std::ofstream File(TemporaryPath, std::ios::binary | std::ios::trunc);
+        File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+        for (const std::vector<std::byte>& BlobIt : Blobs)
+        {
+            File.write(reinterpret_cast<const char*>(std::data(BlobIt)), static_cast<std::streamsize>(std::size(BlobIt)));
+        }
+
+        File.close();
+
+        if (!File)
+        {
+            std::filesystem::remove(TemporaryPath, Error);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(TemporaryPath, Path, Error);
+    if (Error)
+    {
+        std::filesystem::remove(TemporaryPath, Error);
+        return false;
+    }
+
+    return true;
+}
+
+VkPipelineCache PipelineCache::CreateWorkerCache()
+{
+    constexpr VkPipelineCacheCreateInfo Info{.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+
+    VkPipelineCache Cache{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreatePipelineCache(m_DeviceModule->GetLogicalDevice(), &Info, nullptr, &Cache)))
+    {
+        throw std::runtime_error("Failed to create worker pipeline cache");
+    }
+
+    std::lock_guard Lock(m_WorkerMutex);
+    m_WorkerCaches.push_back(Cache);
+
+    return Cache;
+}
+
+void PipelineCache::MergeWorkerCaches()
+{
+    std::lock_guard Lock(m_WorkerMutex);
+
+    if (std::empty(m_WorkerCaches))
+    {
+        return;
+    }
+
+    const VkDevice LogicalDevice = m_DeviceModule->GetLogicalDevice();
+
+    if (m_Composite != VK_NULL_HANDLE)
+    {
+        LUVK_EXECUTE(vkMergePipelineCaches(LogicalDevice, m_Composite, static_cast<std::uint32_t>(std::size(m_WorkerCaches)), std::data(m_WorkerCaches)));
+    }
+
+    for (const VkPipelineCache CacheIt : m_WorkerCaches)
+    {
+        vkDestroyPipelineCache(LogicalDevice, CacheIt, nullptr);
+    }
+
+    m_WorkerCaches.clear();
+}
+
+void PipelineCache::RecordFeedback(const VkPipelineCreationFeedback& Feedback) noexcept
+{
+    if ((Feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) == 0U)
+    {
+        return;
+    }
+
+    if ((Feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) != 0U)
+    {
+        ++m_Hits;
+    }
+    else
+    {
+        ++m_Misses;
+    }
+
+    m_CreationTime += Feedback.duration;
+}
+
+PipelineCache::Statistics PipelineCache::GetStatistics() const noexcept
+{
+    return {.Hits = m_Hits.load(), .Misses = m_Misses.load(), .CreationTime = m_CreationTime.load()};
+}
@@ -0,0 +1,256 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Resources/PipelineRegistry.hpp"
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <utility>
+#include "luvk/Libraries/Hash.hpp"
+
+struct KeyMaterial
+{
+    std::vector<std::byte> Bytes{};
+
+    template <typename Type>
+    void AppendValue(const Type& Value)
+    {
+        const std::span<const std::byte> Data = std::as_bytes(std::span{&Value, 1U});
+        Bytes.insert(std::end(Bytes), std::begin(Data), std::end(Data));
+    }
+
+    template <typename Type>
+    void AppendSpan(const std::span<const Type> Values)
+    {
+        AppendValue(std::size(Values));
+
+        const std::span<const std::byte> Data = std::as_bytes(Values);
+        Bytes.insert(std::end(Bytes), std::begin(Data), std::end(Data));
+    }
+};
+
+luvk::PipelineRegistry::PipelineRegistry(const std::shared_ptr<Device>& DeviceModule)
+    : m_DeviceModule(DeviceModule) {}
+
+std::shared_ptr<luvk::Pipeline> luvk::PipelineRegistry::Acquire(const Pipeline::CreationArguments& Arguments)
+{
+    return FindOrCreate(BuildKeyMaterial(Arguments),
+                        [&Arguments](Pipeline& NewPipeline)
+                        {
+                            NewPipeline.CreateGraphicsPipeline(Arguments);
+                        });
+}
+
+std::shared_ptr<luvk::Pipeline> luvk::PipelineRegistry::Acquire(const Pipeline::ComputeCreationArguments& Arguments)
+{
+    return FindOrCreate(BuildKeyMaterial(Arguments),
+                        [&Arguments](Pipeline& NewPipeline)
+                        {
+                            NewPipeline.CreateComputePipeline(Arguments);
+                        });
+}
+
+std::shared_ptr<luvk::Pipeline> luvk::PipelineRegistry::Acquire(const Pipeline::MeshCreationArguments& Arguments)
+{
+    return FindOrCreate(BuildKeyMaterial(Arguments),
+                        [&Arguments](Pipeline& NewPipeline)
+                        {
+                            NewPipeline.CreateMeshPipeline(Arguments);
+                        });
+}
+
+std::uint64_t luvk::PipelineRegistry::ComputeKey(const Pipeline::CreationArguments& Arguments)
+{
+    return HashBytes(BuildKeyMaterial(Arguments));
+}
+
+std::uint64_t luvk::PipelineRegistry::ComputeKey(const Pipeline::ComputeCreationArguments& Arguments)
+{
+    return HashBytes(BuildKeyMaterial(Arguments));
+}
+
+std::uint64_t luvk::PipelineRegistry::ComputeKey(const Pipeline::MeshCreationArguments& Arguments)
+{
+    return HashBytes(BuildKeyMaterial(Arguments));
+}
+
+std::vector<std::byte> luvk::PipelineRegistry::BuildKeyMaterial(const Pipeline::CreationArguments& Arguments)
+{
+    KeyMaterial Material{};
+
+    Material.AppendValue(Pipeline::Type::Graphics);
+    Material.AppendSpan(Arguments.VertexShader);
+    Material.AppendSpan(Arguments.FragmentShader);
+    Material.AppendSpan(Arguments.Bindings);
+    Material.AppendSpan(Arguments.Attributes);
+    Material.AppendSpan(Arguments.SetLayouts);
+    Material.AppendSpan(Arguments.PushConstants);
+    Material.AppendSpan(Arguments.ColorFormats);
+    Material.AppendValue(Arguments.RenderPass);
+    Material.AppendValue(Arguments.Subpass);
+    Material.AppendValue(Arguments.Topology);
+    Material.AppendValue(Arguments.CullMode);
+    Material.AppendValue(Arguments.FrontFace);
+    Material.AppendValue(Arguments.EnableDepthOp);
+    Material.AppendValue(Arguments.EnableDepthWrite);
+    Material.AppendValue(Arguments.DepthCompareOp);
+    Material.AppendValue(Arguments.ColorWriteMask);
+    Material.AppendValue(Arguments.Flags);
+
+    return std::move(Material.Bytes);
+}
+
+std::vector<std::byte> luvk::PipelineRegistry::BuildKeyMaterial(const Pipeline::ComputeCreationArguments& Arguments)
+{
+    KeyMaterial Material{};
+
+    Material.AppendValue(Pipeline::Type::Compute);
+    Material.AppendSpan(Arguments.ComputeShader);
+    Material.AppendSpan(Arguments.SetLayouts);
+    Material.AppendSpan(Arguments.PushConstants);
+    Material.AppendValue(Arguments.Flags);
+
+    return std::move(Material.Bytes);
+}
+
+std::vector<std::byte> luvk::PipelineRegistry::BuildKeyMaterial(const Pipeline::MeshCreationArguments& Arguments)
+{
+    KeyMaterial Material{};
+
+    Material.AppendValue(Pipeline::Type::Mesh);
+    Material.AppendSpan(Arguments.TaskShader);
+    Material.AppendSpan(Arguments.MeshShader);
+    Material.AppendSpan(Arguments.FragmentShader);
+    Material.AppendSpan(Arguments.SetLayouts);
+    Material.AppendSpan(Arguments.PushConstants);
+    Material.AppendSpan(Arguments.ColorFormats);
+    Material.AppendValue(Arguments.RenderPass);
+    Material.AppendValue(Arguments.Subpass);
+    Material.AppendValue(Arguments.CullMode);
+    Material.AppendValue(Arguments.FrontFace);
+    Material.AppendValue(Arguments.EnableDepthOp);
+    Material.AppendValue(Arguments.Flags);
+
+    return std::move(Material.Bytes);
+}
+
+void luvk::PipelineRegistry::Prune()
+{
+    std::lock_guard Lock(m_Mutex);
+
+    for (std::vector<Entry>& BucketIt : m_Entries | std::views::values)
+    {
+        std::erase_if(BucketIt,
+                      [](const Entry& EntryIt)
+                      {
+                          return !EntryIt.Pending.valid() && EntryIt.Resolved.expired();
+                      });
+    }
+
+    std::erase_if(m_Entries,
+                  [](const auto& BucketIt)
+                  {
+                      return std::empty(BucketIt.second);
+                  });
+}
+
+std::size_t luvk::PipelineRegistry::GetPipelineCount()
+{
+    std::lock_guard Lock(m_Mutex);
+
+    std::size_t Count = 0U;
+
+    for (const std::vector<Entry>& BucketIt : m_Entries | std::views::values)
+    {
+        Count += static_cast<std::size_t>(std::ranges::count_if(BucketIt,
+                                                                [](const Entry& EntryIt)
+                                                                {
+                                                                    return !EntryIt.Resolved.expired();
+                                                                }));
+    }
+
+    return Count;
+}
+
+std::shared_ptr<luvk::Pipeline> luvk::PipelineRegistry::FindOrCreate(std::vector<std::byte>&& Material, const std::function<void(Pipeline&)>& Create)
+{
+    const std::uint64_t Key = HashBytes(Material);
+
+    auto FindEntry = [this, Key, &Material]() -> Entry*
+    {
+        std::vector<Entry>& Bucket = m_Entries[Key];
+
+        const auto Found = std::ranges::find_if(Bucket,
+                                                [&Material](const Entry& Candidate)
+                                                {
+                                                    return std::ranges::equal(Candidate.Material, Material);
+                                                });
+
+        return Found != std::end(Bucket) ? &*Found : nullptr;
+    };
+
+    std::promise<std::shared_ptr<Pipeline>> Promise{};
+
+    {
+        std::unique_lock Lock(m_Mutex);
+
+        if (Entry* const Found = FindEntry())
+        {
+            if (std::shared_ptr<Pipeline> Existing = Found->Resolved.lock())
+            {
+                ++m_Reuses;
+                return Existing;
+            }
+
+            if (Found->Pending.valid())
+            {
+                const std::shared_future Pending = Found->Pending;
+                Lock.unlock();
+
+                ++m_Reuses;
+                return Pending.get();
+            }
+
+            Found->Pending = Promise.get_future().share();
+        }
+        else
+        {
+            m_Entries[Key].push_back({.Material = Material, .Pending = Promise.get_future().share()});
+        }
+    }
+
+    auto NewPipeline = std::make_shared<Pipeline>(m_DeviceModule);
+
+    try
+    {
+        Create(*NewPipeline);
+    }
+    catch (...)
+    {
+        Promise.set_exception(std::current_exception());
+
+        std::lock_guard Lock(m_Mutex);
+        std::erase_if(m_Entries[Key],
+                      [&Material](const Entry& Candidate)
+                      {
+                          return std::ranges::equal(Candidate.Material, Material);
+                      });
+        throw;
+    }
+
+    ++m_Compiles;
+    Promise.set_value(NewPipeline);
+
+    std::lock_guard Lock(m_Mutex);
+
+    if (Entry* const Found = FindEntry())
+    {
+        Found->Resolved = NewPipeline;
+        Found->Pending  = {};
+    }
+
+    return NewPipeline;
+}
@@ -28,7 +28,7 @@ void luvk::Sampler::CreateSampler(const CreationArguments& Arguments)
                                    .flags = 0,
                                    .magFilter = Arguments.Filter,
                                    .minFilter = Arguments.Filter,
-                                   .mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR,
+                                   .mipmapMode = Arguments.MipmapMode,
                                    .addressModeU = Arguments.AddressMode,
                                    .addressModeV = Arguments.AddressMode,
                                    .addressModeW = Arguments.AddressMode,
@@ -0,0 +1,85 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Resources/ShaderModuleCache.hpp"
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include "luvk/Libraries/Hash.hpp"
+#include "luvk/Libraries/VulkanHelpers.hpp"
+#include "luvk/Modules/Device.hpp"
+
+luvk::ShaderModuleCache::ShaderModuleCache(const std::shared_ptr<Device>& DeviceModule)
+    : m_DeviceModule(DeviceModule) {}
+
+luvk::ShaderModuleCache::~ShaderModuleCache()
+{
+    Clear();
+}
+
+VkShaderModule luvk::ShaderModuleCache::Acquire(const std::span<const std::uint32_t> Code)
+{
+    const std::uint64_t Hash = HashSpan(Code);
+
+    std::lock_guard Lock(m_Mutex);
+
+    std::vector<Entry>& Bucket = m_Entries[Hash];
+
+    if (const auto EntryIt = std::ranges::find_if(Bucket,
+                                                  [Code](const Entry& Candidate)
+                                                  {
+                                                      return std::ranges::equal(Candidate.Code, Code);
+                                                  });
+        EntryIt != std::end(Bucket))
+    {
+        return EntryIt->Module;
+    }
+
+    const VkShaderModuleCreateInfo Info{.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+                                        .codeSize = std::size(Code) * sizeof(std::uint32_t),
+                                        .pCode = std::data(Code)};
+
+    VkShaderModule Module{VK_NULL_HANDLE};
+    if (!LUVK_EXECUTE(vkCreateShaderModule(m_DeviceModule->GetLogicalDevice(), &Info, nullptr, &Module)))
+    {
+        throw std::runtime_error("Failed to create shader module.");
+    }
+
+    Bucket.push_back({.Code = {std::begin(Code), std::end(Code)}, .Module = Module});
+
+    return Module;
+}
+
+std::size_t luvk::ShaderModuleCache::GetModuleCount()
+{
+    std::lock_guard Lock(m_Mutex);
+
+    std::size_t Count = 0U;
+
+    for (const std::vector<Entry>& BucketIt : m_Entries | std::views::values)
+    {
+        Count += std::size(BucketIt);
+    }
+
+    return Count;
+}
+
+void luvk::ShaderModuleCache::Clear()
+{
+    std::lock_guard Lock(m_Mutex);
+
+    if (m_DeviceModule)
+    {
+        for (const std::vector<Entry>& BucketIt : m_Entries | std::views::values)
+        {
+            for (const Entry& EntryIt : BucketIt)
+            {
+                vkDestroyShaderModule(m_DeviceModule->GetLogicalDevice(), EntryIt.Module, nullptr);
+            }
+        }
+    }
+
+    m_Entries.clear();
+}
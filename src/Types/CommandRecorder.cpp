@@ -0,0 +1,236 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Types/CommandRecorder.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+luvk::CommandRecorder::CommandRecorder(const VkCommandBuffer CommandBuffer) noexcept
+    : m_CommandBuffer(CommandBuffer) {}
+
+void luvk::CommandRecorder::Invalidate() noexcept
+{
+    m_BindPoints = {};
+    m_VertexBuffers.fill(VK_NULL_HANDLE);
+    m_VertexOffsets.fill(0U);
+    m_IndexBuffer = VK_NULL_HANDLE;
+    m_IndexOffset = 0U;
+    m_IndexType   = VK_INDEX_TYPE_MAX_ENUM;
+    m_HasViewport = false;
+    m_HasScissor  = false;
+}
+
+void luvk::CommandRecorder::InvalidateDescriptorSet(const VkPipelineBindPoint BindPoint, const std::uint32_t SetIndex) noexcept
+{
+    const std::size_t StateIndex = BindPoint == VK_PIPELINE_BIND_POINT_COMPUTE ? 1U : 0U;
+
+    if (SetIndex < MaxDescriptorSets)
+    {
+        m_BindPoints.at(StateIndex).Sets.at(SetIndex) = {};
+    }
+}
+
+bool luvk::CommandRecorder::BindPipeline(const VkPipelineBindPoint BindPoint, const VkPipeline Pipeline, const VkPipelineLayout Layout)
+{
+    BindPointState& State = GetState(BindPoint);
+
+    if (State.Pipeline == Pipeline)
+    {
+        ++m_SkippedCommands;
+        return false;
+    }
+
+    vkCmdBindPipeline(m_CommandBuffer, BindPoint, Pipeline);
+    ++m_IssuedCommands;
+
+    State.Pipeline = Pipeline;
+
+    if (State.Layout != Layout)
+    {
+        State.Layout = Layout;
+        State.Sets   = {};
+    }
+
+    return true;
+}
+
+bool luvk::CommandRecorder::BindDescriptorSet(const VkPipelineBindPoint            BindPoint,
+                                              const VkPipelineLayout               Layout,
+                                              const std::uint32_t                  SetIndex,
+                                              const VkDescriptorSet                Set,
+                                              const std::span<const std::uint32_t> DynamicOffsets)
+{
+    BindPointState& State     = GetState(BindPoint);
+    const bool      Cacheable = SetIndex < MaxDescriptorSets && std::size(DynamicOffsets) <= MaxDynamicOffsets;
+
+    if (State.Layout != Layout)
+    {
+        State.Layout = Layout;
+        State.Sets   = {};
+    }
+
+    if (Cacheable)
+    {
+        const BoundSet& Bound = State.Sets.at(SetIndex);
+
+        if (Bound.Set == Set &&
+            Bound.OffsetCount == std::size(DynamicOffsets) &&
+            std::equal(std::begin(DynamicOffsets), std::end(DynamicOffsets), std::begin(Bound.Offsets)))
+        {
+            ++m_SkippedCommands;
+            return false;
+        }
+    }
+
+    vkCmdBindDescriptorSets(m_CommandBuffer,
+                            BindPoint,
+                            Layout,
+                            SetIndex,
+                            1,
+                            &Set,
+                            static_cast<std::uint32_t>(std::size(DynamicOffsets)),
+                            std::data(DynamicOffsets));
+    ++m_IssuedCommands;
+
+    if (Cacheable)
+    {
+        BoundSet& Bound   = State.Sets.at(SetIndex);
+        Bound.Set         = Set;
+        Bound.OffsetCount = static_cast<std::uint32_t>(std::size(DynamicOffsets));
+        std::ranges::copy(DynamicOffsets, std::begin(Bound.Offsets));
+    }
+    else if (SetIndex < MaxDescriptorSets)
+    {
+        State.Sets.at(SetIndex) = {};
+    }
+
+    return true;
+}
+
+bool luvk::CommandRecorder::BindVertexBuffers(const std::uint32_t                 FirstBinding,
+                                              const std::span<const VkBuffer>     Buffers,
+                                              const std::span<const VkDeviceSize> Offsets)
+{
+    if (std::empty(Buffers))
+    {
+        return false;
+    }
+
+    const std::size_t Count = std::size(Buffers);
+
+    if (FirstBinding + Count <= MaxVertexBindings &&
+        std::equal(std::begin(Buffers), std::end(Buffers), std::begin(m_VertexBuffers) + FirstBinding) &&
+        std::equal(std::begin(Offsets), std::end(Offsets), std::begin(m_VertexOffsets) + FirstBinding))
+    {
+        ++m_SkippedCommands;
+        return false;
+    }
+
+    vkCmdBindVertexBuffers(m_CommandBuffer, FirstBinding, static_cast<std::uint32_t>(Count), std::data(Buffers), std::data(Offsets));
+    ++m_IssuedCommands;
+
+    for (std::size_t Index = 0U; Index < Count && FirstBinding + Index < MaxVertexBindings; ++Index)
+    {
+        m_VertexBuffers.at(FirstBinding + Index) = Buffers[Index];
+        m_VertexOffsets.at(FirstBinding + Index) = Offsets[Index];
+    }
+
+    return true;
+}
+
+bool luvk::CommandRecorder::BindIndexBuffer(const VkBuffer Buffer, const VkDeviceSize Offset, const VkIndexType IndexType)
+{
+    if (m_IndexBuffer == Buffer && m_IndexOffset == Offset && m_IndexType == IndexType)
+    {
+        ++m_SkippedCommands;
+        return false;
+    }
+
+    vkCmdBindIndexBuffer(m_CommandBuffer, Buffer, Offset, IndexType);
+    ++m_IssuedCommands;
+
+    m_IndexBuffer = Buffer;
+    m_IndexOffset = Offset;
+    m_IndexType   = IndexType;
+
+    return true;
+}
+
+bool luvk::CommandRecorder::SetViewport(const VkViewport& Viewport)
+{
+    if (m_HasViewport &&
+        m_Viewport.x == Viewport.x &&
+        m_Viewport.y == Viewport.y &&
+        m_Viewport.width == Viewport.width &&
+        m_Viewport.height == Viewport.height &&
+        m_Viewport.minDepth == Viewport.minDepth &&
+        m_Viewport.maxDepth == Viewport.maxDepth)
+    {
+        ++m_SkippedCommands;
+        return false;
+    }
+
+    vkCmdSetViewport(m_CommandBuffer, 0U, 1U, &Viewport);
+    ++m_IssuedCommands;
+
+    m_Viewport    = Viewport;
+    m_HasViewport = true;
+
+    return true;
+}
+
+bool luvk::CommandRecorder::SetScissor(const VkRect2D& Scissor)
+{
+    if (m_HasScissor &&
+        m_Scissor.offset.x == Scissor.offset.x &&
+        m_Scissor.offset.y == Scissor.offset.y &&
+        m_Scissor.extent.width == Scissor.extent.width &&
+        m_Scissor.extent.height == Scissor.extent.height)
+    {
+        ++m_SkippedCommands;
+        return false;
+    }
+
+    vkCmdSetScissor(m_CommandBuffer, 0U, 1U, &Scissor);
+    ++m_IssuedCommands;
+
+    m_Scissor    = Scissor;
+    m_HasScissor = true;
+
+    return true;
+}
+
+void luvk::CommandRecorder::PushConstants(const VkPipelineLayout           Layout,
+                                          const VkShaderStageFlags         Stages,
+                                          const std::uint32_t              Offset,
+                                          const std::span<const std::byte> Data)
+{
+    vkCmdPushConstants(m_CommandBuffer, Layout, Stages, Offset, static_cast<std::uint32_t>(std::size(Data)), std::data(Data));
+    ++m_IssuedCommands;
+}
+
+void luvk::CommandRecorder::PipelineBarrier(const VkPipelineStageFlags SourceStage,
+                                            const VkAccessFlags        SourceAccess,
+                                            const VkPipelineStageFlags TargetStage,
+                                            const VkAccessFlags        TargetAccess)
+{
+    const VkMemoryBarrier Barrier{.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                                  .pNext = nullptr,
+                                  .srcAccessMask = SourceAccess,
+                                  .dstAccessMask = TargetAccess};
+
+    vkCmdPipelineBarrier(m_CommandBuffer, SourceStage, TargetStage, 0, 1, &Barrier, 0, nullptr, 0, nullptr);
+    ++m_IssuedCommands;
+}
+
+luvk::CommandRecorder::BindPointState& luvk::CommandRecorder::GetState(const VkPipelineBindPoint BindPoint)
+{
+    switch (BindPoint)
+    {
+    case VK_PIPELINE_BIND_POINT_GRAPHICS: return m_BindPoints.at(0U);
+    case VK_PIPELINE_BIND_POINT_COMPUTE: return m_BindPoints.at(1U);
+    default: throw std::runtime_error("Unsupported pipeline bind point.");
+    }
+}
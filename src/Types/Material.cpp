@@ -3,11 +3,15 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Types/Material.hpp"
+#include <stdexcept>
+#include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/UniformArena.hpp"
 #include "luvk/Resources/Buffer.hpp"
 #include "luvk/Resources/DescriptorSet.hpp"
 #include "luvk/Resources/Image.hpp"
 #include "luvk/Resources/Pipeline.hpp"
 #include "luvk/Resources/Sampler.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
 #include "luvk/Types/Texture.hpp"
 
 void luvk::Material::Initialize(const std::shared_ptr<Device>&         Device,
@@ -15,37 +19,81 @@ void luvk::Material::Initialize(const std::shared_ptr<Device>&         Device,
                                 const std::shared_ptr<Memory>&         Memory,
                                 const std::shared_ptr<Pipeline>&       PipelineObj)
 {
+    m_Device   = Device;
     m_Pipeline = PipelineObj;
 
     if (m_Pipeline)
     {
-        m_DescriptorSet = std::make_shared<DescriptorSet>(Device, Pool, Memory);
+        for (std::shared_ptr<DescriptorSet>& SetIt : m_DescriptorSets)
+        {
+            SetIt = std::make_shared<DescriptorSet>(Device, Pool, Memory);
+        }
     }
 }
 
-void luvk::Material::AllocateDescriptorSet(const std::span<const VkDescriptorSetLayoutBinding> Bindings) const
+void luvk::Material::AllocateDescriptorSet(const std::span<const VkDescriptorSetLayoutBinding> Bindings, const bool PreferPushDescriptors)
 {
-    if (m_DescriptorSet)
+    const std::shared_ptr<DescriptorSet> LayoutOwner = m_DescriptorSets.front();
+
+    if (!LayoutOwner)
+    {
+        return;
+    }
+
+    m_UsePushDescriptors = PreferPushDescriptors && m_Device && m_Device->SupportsPushDescriptors();
+    LayoutOwner->CreateLayout({.Bindings = Bindings, .PushDescriptor = m_UsePushDescriptors});
+
+    if (m_UsePushDescriptors)
     {
-        m_DescriptorSet->CreateLayout({.Bindings = Bindings});
-        m_DescriptorSet->Allocate();
+        m_DescriptorSets.fill(LayoutOwner);
+        return;
+    }
+
+    for (const std::shared_ptr<DescriptorSet>& SetIt : m_DescriptorSets)
+    {
+        if (SetIt != LayoutOwner)
+        {
+            SetIt->UseLayout(LayoutOwner->GetLayout(), Bindings);
+        }
+
+        SetIt->Allocate();
     }
 }
 
-void luvk::Material::Bind(const VkCommandBuffer CommandBuffer) const
+void luvk::Material::Bind(CommandRecorder&                     Recorder,
+                          const std::uint32_t                  FrameIndex,
+                          const std::span<const std::uint32_t> DynamicOffsets) const
 {
     if (!m_Pipeline)
     {
         return;
     }
 
-    const VkPipelineBindPoint BindPoint = m_Pipeline->GetBindPoint();
-    vkCmdBindPipeline(CommandBuffer, BindPoint, m_Pipeline->GetPipeline());
+    const VkPipelineBindPoint BindPoint      = m_Pipeline->GetBindPoint();
+    const VkPipelineLayout    PipelineLayout = m_Pipeline->GetPipelineLayout();
+    Recorder.BindPipeline(BindPoint, m_Pipeline->GetPipeline(), PipelineLayout);
+
+    const std::shared_ptr<DescriptorSet> Set = GetDescriptor(FrameIndex);
 
-    if (m_DescriptorSet && m_DescriptorSet->GetHandle() != VK_NULL_HANDLE)
+    if (Set && Set->IsPushDescriptor())
     {
-        const VkDescriptorSet SetHandle = m_DescriptorSet->GetHandle();
-        vkCmdBindDescriptorSets(CommandBuffer, BindPoint, m_Pipeline->GetPipelineLayout(), 0, 1, &SetHandle, 0, nullptr);
+        if (m_UniformArena && !std::empty(DynamicOffsets))
+        {
+            Set->UpdateBuffer(m_UniformArena->GetBuffer(FrameIndex)->GetHandle(),
+                              m_UniformRange,
+                              m_UniformBinding,
+                              VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                              DynamicOffsets.front());
+        }
+
+        Set->Push(Recorder, BindPoint, PipelineLayout);
+        Recorder.InvalidateDescriptorSet(BindPoint, 0);
+    }
+    else if (Set && Set->GetHandle() != VK_NULL_HANDLE)
+    {
+        Set->Flush();
+
+        Recorder.BindDescriptorSet(BindPoint, PipelineLayout, 0, Set->GetHandle(), DynamicOffsets);
     }
 }
 
@@ -56,25 +104,65 @@ void luvk::Material::SetPipeline(const std::shared_ptr<Pipeline>& PipelineObj)
 
 void luvk::Material::SetDescriptorSet(const std::shared_ptr<DescriptorSet>& DescriptorSetObj)
 {
-    m_DescriptorSet = DescriptorSetObj;
+    m_DescriptorSets.fill(DescriptorSetObj);
+}
+
+void luvk::Material::SetDescriptorSet(const std::shared_ptr<DescriptorSet>& DescriptorSetObj, const std::uint32_t FrameIndex)
+{
+    m_DescriptorSets.at(FrameIndex) = DescriptorSetObj;
 }
 
 void luvk::Material::SetTexture(const std::shared_ptr<Texture>& TextureObj)
 {
     m_Texture = TextureObj;
-    if (m_DescriptorSet && m_Texture)
+
+    if (!m_Texture)
+    {
+        return;
+    }
+
+    for (const std::shared_ptr<DescriptorSet>& SetIt : m_DescriptorSets)
+    {
+        if (SetIt)
+        {
+            SetIt->UpdateImage(m_Texture->GetImage()->GetView(),
+                               m_Texture->GetSampler()->GetHandle(),
+                               0,
+                               VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+        }
+    }
+}
+
+void luvk::Material::SetUniformBuffer(const std::shared_ptr<Buffer>& BufferObj, const std::uint32_t FrameIndex, const std::uint32_t Binding) const
+{
+    if (const std::shared_ptr<DescriptorSet> Set = GetDescriptor(FrameIndex);
+        Set && BufferObj)
     {
-        m_DescriptorSet->UpdateImage(m_Texture->GetImage()->GetView(),
-                                     m_Texture->GetSampler()->GetHandle(),
-                                     0,
-                                     VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+        Set->UpdateBuffer(BufferObj->GetHandle(), BufferObj->GetSize(), Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
     }
 }
 
-void luvk::Material::SetUniformBuffer(const std::shared_ptr<Buffer>& BufferObj, const std::uint32_t Binding) const
+void luvk::Material::SetUniformArena(const std::shared_ptr<UniformArena>& Arena, const VkDeviceSize Range, const std::uint32_t Binding)
 {
-    if (m_DescriptorSet && BufferObj)
+    if (Arena && (Range == 0U || Range > Arena->GetCapacity()))
+    {
+        throw std::runtime_error("Dynamic uniform range must fit within the uniform arena capacity.");
+    }
+
+    m_UniformArena   = Arena;
+    m_UniformRange   = Range;
+    m_UniformBinding = Binding;
+
+    if (!m_UniformArena || m_UsePushDescriptors)
+    {
+        return;
+    }
+
+    for (std::uint32_t Frame = 0U; Frame < Constants::ImageCount; ++Frame)
     {
-        m_DescriptorSet->UpdateBuffer(BufferObj->GetHandle(), BufferObj->GetSize(), Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        if (const std::shared_ptr<DescriptorSet>& Set = m_DescriptorSets.at(Frame))
+        {
+            Set->UpdateBuffer(m_UniformArena->GetBuffer(Frame)->GetHandle(), Range, Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
+        }
     }
 }
@@ -3,20 +3,110 @@
 // Repo : https://github.com/lucoiso/luvk
 
 #include "luvk/Types/Mesh.hpp"
+#include <algorithm>
+#include <stdexcept>
 #include "luvk/Constants/Rendering.hpp"
 #include "luvk/Modules/Device.hpp"
+#include "luvk/Modules/UniformArena.hpp"
 #include "luvk/Resources/Buffer.hpp"
 #include "luvk/Resources/Pipeline.hpp"
+#include "luvk/Types/CommandRecorder.hpp"
 #include "luvk/Types/Material.hpp"
 
 using namespace luvk;
 
+static bool HasBuffers(const std::array<std::shared_ptr<Buffer>, Constants::ImageCount>& Buffers)
+{
+    return std::ranges::any_of(Buffers,
+                               [](const std::shared_ptr<Buffer>& BufferIt)
+                               {
+                                   return BufferIt != nullptr;
+                               });
+}
+
 Mesh::Mesh(const std::shared_ptr<Device>& Device, const std::shared_ptr<Memory>& Memory)
     : m_Device(Device),
       m_Memory(Memory) {}
 
+Mesh::~Mesh()
+{
+    Mesh::DisableCulling();
+    Mesh::DisableOcclusionQuery();
+}
+
+void Mesh::EnableCulling(const std::shared_ptr<InstanceCulling>& Culling)
+{
+    DisableCulling();
+
+    if (Culling)
+    {
+        m_CullingTarget = Culling->RegisterTarget();
+        m_Culling       = Culling;
+    }
+}
+
+void Mesh::DisableCulling()
+{
+    if (m_Culling)
+    {
+        m_Culling->ReleaseTarget(m_CullingTarget);
+        m_Culling.reset();
+    }
+
+    m_CullingTarget = 0U;
+}
+
+void Mesh::EnableOcclusionQuery(const std::shared_ptr<OcclusionQueries>& Occlusion)
+{
+    DisableOcclusionQuery();
+
+    if (Occlusion)
+    {
+        m_OcclusionQuery = Occlusion->RegisterQuery();
+        m_Occlusion      = Occlusion;
+    }
+}
+
+void Mesh::DisableOcclusionQuery()
+{
+    if (m_Occlusion)
+    {
+        m_Occlusion->ReleaseQuery(m_OcclusionQuery);
+        m_Occlusion.reset();
+    }
+
+    m_OcclusionQuery = 0U;
+}
+
+void Mesh::EnableMeshlets(const std::shared_ptr<Meshlets>& MeshletsModule, const std::uint32_t GeometryIndex)
+{
+    m_Meshlets        = MeshletsModule;
+    m_MeshletGeometry = GeometryIndex;
+}
+
+void Mesh::DisableMeshlets()
+{
+    m_Meshlets.reset();
+    m_MeshletGeometry = 0U;
+}
+
 void Mesh::UploadVertices(const std::span<const std::byte> Data, const std::uint32_t VertexCount, const std::uint32_t FrameIndex)
 {
+    if (m_StaticVertices)
+    {
+        m_Device->WaitIdle();
+        m_VertexBuffers  = {};
+        m_StaticVertices = false;
+
+        for (std::uint32_t FrameIt = 0U; FrameIt < Constants::ImageCount; ++FrameIt)
+        {
+            if (FrameIt != FrameIndex)
+            {
+                UploadVertices(Data, VertexCount, FrameIt);
+            }
+        }
+    }
+
     auto& Buffer = m_VertexBuffers.at(FrameIndex);
 
     if (!Buffer || Buffer->GetSize() < Data.size_bytes())
@@ -31,10 +121,31 @@ void Mesh::UploadVertices(const std::span<const std::byte> Data, const std::uint
     m_VertexCount = VertexCount;
 }
 
+void Mesh::UploadVertices(const CompressedVertices& Vertices, const std::uint32_t FrameIndex)
+{
+    UploadVertices(Vertices.Data, Vertices.VertexCount, FrameIndex);
+    m_Dequantization = Vertices.Dequantization;
+}
+
 void Mesh::UploadIndices(const std::span<const std::uint16_t> Data, const std::uint32_t FrameIndex)
 {
     m_IndexType = VK_INDEX_TYPE_UINT16;
 
+    if (m_StaticIndices)
+    {
+        m_Device->WaitIdle();
+        m_IndexBuffers  = {};
+        m_StaticIndices = false;
+
+        for (std::uint32_t FrameIt = 0U; FrameIt < Constants::ImageCount; ++FrameIt)
+        {
+            if (FrameIt != FrameIndex)
+            {
+                UploadIndices(Data, FrameIt);
+            }
+        }
+    }
+
     auto& Buffer = m_IndexBuffers.at(FrameIndex);
 
     if (const std::size_t Bytes = Data.size_bytes();
@@ -54,6 +165,21 @@ void Mesh::UploadIndices(const std::span<const std::uint32_t> Data, const std::u
 {
     m_IndexType = VK_INDEX_TYPE_UINT32;
 
+    if (m_StaticIndices)
+    {
+        m_Device->WaitIdle();
+        m_IndexBuffers  = {};
+        m_StaticIndices = false;
+
+        for (std::uint32_t FrameIt = 0U; FrameIt < Constants::ImageCount; ++FrameIt)
+        {
+            if (FrameIt != FrameIndex)
+            {
+                UploadIndices(Data, FrameIt);
+            }
+        }
+    }
+
     auto& Buffer = m_IndexBuffers.at(FrameIndex);
 
     if (const std::size_t Bytes = Data.size_bytes();
@@ -69,6 +195,103 @@ void Mesh::UploadIndices(const std::span<const std::uint32_t> Data, const std::u
     m_IndexCount = static_cast<std::uint32_t>(std::size(Data));
 }
 
+void Mesh::UploadGeometry(const OptimizedGeometry& Geometry, const std::uint32_t VertexStride, const std::uint32_t FrameIndex)
+{
+    if (VertexStride == 0U || std::size(Geometry.Vertices) != static_cast<std::size_t>(Geometry.VertexCount) * VertexStride)
+    {
+        throw std::runtime_error("Optimized geometry does not match the vertex stride.");
+    }
+
+    UploadVertices(Geometry.Vertices, Geometry.VertexCount, FrameIndex);
+
+    if (Geometry.CanUseUInt16Indices())
+    {
+        UploadIndices(std::span<const std::uint16_t>(ConvertIndicesToUInt16(Geometry.Indices)), FrameIndex);
+    }
+    else
+    {
+        UploadIndices(std::span<const std::uint32_t>(Geometry.Indices), FrameIndex);
+    }
+}
+
+void Mesh::UploadStaticGeometry(const GeometryOptimizationArguments& Arguments)
+{
+    const OptimizedGeometry Geometry = OptimizeGeometry(Arguments);
+
+    UploadStaticVertices(Geometry.Vertices, Geometry.VertexCount);
+
+    if (Geometry.CanUseUInt16Indices())
+    {
+        UploadStaticIndices(std::span<const std::uint16_t>(ConvertIndicesToUInt16(Geometry.Indices)));
+    }
+    else
+    {
+        UploadStaticIndices(std::span<const std::uint32_t>(Geometry.Indices));
+    }
+}
+
+void Mesh::UploadStaticVertices(const std::span<const std::byte> Data, const std::uint32_t VertexCount)
+{
+    const auto Buffer = std::make_shared<luvk::Buffer>(m_Device, m_Memory);
+    Buffer->CreateBuffer({.Size = Data.size_bytes(),
+                          .Usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                          .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                          .PreferDirectWrites = true,
+                          .Name = "Mesh Static VTX"});
+    Buffer->UploadStaged(Data);
+
+    if (HasBuffers(m_VertexBuffers))
+    {
+        m_Device->WaitIdle();
+    }
+
+    m_VertexBuffers.fill(Buffer);
+    m_VertexCount    = VertexCount;
+    m_StaticVertices = true;
+}
+
+void Mesh::UploadStaticIndices(const std::span<const std::uint16_t> Data)
+{
+    const auto Buffer = std::make_shared<luvk::Buffer>(m_Device, m_Memory);
+    Buffer->CreateBuffer({.Size = Data.size_bytes(),
+                          .Usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                          .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                          .PreferDirectWrites = true,
+                          .Name = "Mesh Static IDX"});
+    Buffer->UploadStaged(std::as_bytes(Data));
+
+    if (HasBuffers(m_IndexBuffers))
+    {
+        m_Device->WaitIdle();
+    }
+
+    m_IndexBuffers.fill(Buffer);
+    m_IndexType     = VK_INDEX_TYPE_UINT16;
+    m_IndexCount    = static_cast<std::uint32_t>(std::size(Data));
+    m_StaticIndices = true;
+}
+
+void Mesh::UploadStaticIndices(const std::span<const std::uint32_t> Data)
+{
+    const auto Buffer = std::make_shared<luvk::Buffer>(m_Device, m_Memory);
+    Buffer->CreateBuffer({.Size = Data.size_bytes(),
+                          .Usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                          .MemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY,
+                          .PreferDirectWrites = true,
+                          .Name = "Mesh Static IDX"});
+    Buffer->UploadStaged(std::as_bytes(Data));
+
+    if (HasBuffers(m_IndexBuffers))
+    {
+        m_Device->WaitIdle();
+    }
+
+    m_IndexBuffers.fill(Buffer);
+    m_IndexType     = VK_INDEX_TYPE_UINT32;
+    m_IndexCount    = static_cast<std::uint32_t>(std::size(Data));
+    m_StaticIndices = true;
+}
+
 void Mesh::UpdateInstances(const std::span<const std::byte> Data, const std::uint32_t Count, const std::uint32_t FrameIndex)
 {
     auto& Buffer = m_InstanceBuffers.at(FrameIndex);
@@ -82,11 +305,104 @@ void Mesh::UpdateInstances(const std::span<const std::byte> Data, const std::uin
                               .Name = "Instance Data"});
     }
     Buffer->Upload(Data);
-    m_InstanceCount = Count;
+    m_InstanceCount  = Count;
+    m_InstanceStride = Count > 0U ? static_cast<std::uint32_t>(Data.size_bytes() / Count) : 0U;
+}
+
+void Mesh::UpdateInstances(const TransformBatch& Transforms, const TransformBatch::MatrixLayout Layout, const std::uint32_t FrameIndex)
+{
+    WriteInstanceMatrices(Transforms.GetCount(),
+                          Layout,
+                          FrameIndex,
+                          [&Transforms, Layout](const std::span<std::byte> Output)
+                          {
+                              Transforms.Build(Output, Layout);
+                          });
+}
+
+void Mesh::UpdateInstances(const TransformHierarchy& Hierarchy, const TransformBatch::MatrixLayout Layout, const std::uint32_t FrameIndex)
+{
+    WriteInstanceMatrices(Hierarchy.GetCount(),
+                          Layout,
+                          FrameIndex,
+                          [&Hierarchy, Layout](const std::span<std::byte> Output)
+                          {
+                              Hierarchy.Build(Output, Layout);
+                          });
+}
+
+void Mesh::WriteInstanceMatrices(const std::size_t                                Count,
+                                 const TransformBatch::MatrixLayout               Layout,
+                                 const std::uint32_t                              FrameIndex,
+                                 const std::function<void(std::span<std::byte>)>& Writer)
+{
+    const std::size_t Stride = TransformBatch::GetMatrixSize(Layout);
+    const std::size_t Bytes  = Stride * Count;
+
+    auto& Buffer = m_InstanceBuffers.at(FrameIndex);
+
+    if (Bytes > 0U && (!Buffer || Buffer->GetSize() < Bytes))
+    {
+        Buffer = std::make_shared<luvk::Buffer>(m_Device, m_Memory);
+        Buffer->CreateBuffer({.Size = Bytes,
+                              .Usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                              .MemoryUsage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+                              .Name = "Instance Data"});
+    }
+
+    if (Bytes > 0U)
+    {
+        if (const std::span<std::byte> Mapped = Buffer->GetMappedData();
+            !std::empty(Mapped))
+        {
+            Writer(Mapped.first(Bytes));
+            Buffer->Flush(0, Bytes);
+        }
+        else
+        {
+            std::vector<std::byte> Matrices(Bytes);
+            Writer(Matrices);
+            Buffer->Upload(Matrices);
+        }
+    }
+
+    m_InstanceCount  = static_cast<std::uint32_t>(Count);
+    m_InstanceStride = static_cast<std::uint32_t>(Stride);
+}
+
+void Mesh::UpdateInstanceBounds(const std::span<const InstanceCulling::InstanceBounds> Bounds, const std::uint32_t FrameIndex) const
+{
+    if (!m_Culling)
+    {
+        return;
+    }
+
+    if (std::size(Bounds) != m_InstanceCount)
+    {
+        throw std::runtime_error("Mesh instance bounds must match the uploaded instance count.");
+    }
+
+    const std::shared_ptr<Buffer>& InstanceBuffer = m_InstanceBuffers.at(FrameIndex);
+    const bool                     Indexed        = m_IndexBuffers.at(FrameIndex) != nullptr;
+
+    m_Culling->SetTargetInstances(m_CullingTarget,
+                                  FrameIndex,
+                                  {.SourceInstances = InstanceBuffer ? InstanceBuffer->GetHandle() : VK_NULL_HANDLE,
+                                   .InstanceStride = m_InstanceStride,
+                                   .ElementCount = Indexed ? m_IndexCount : m_VertexCount,
+                                   .Indexed = Indexed},
+                                  Bounds);
 }
 
 void Mesh::UpdateUniformBuffer(const std::span<const std::byte> Data, const std::uint32_t FrameIndex)
 {
+    m_UniformData.assign(std::begin(Data), std::end(Data));
+
+    if (m_Material && m_Material->GetUniformArena())
+    {
+        return;
+    }
+
     auto& Buffer = m_UniformBuffers.at(FrameIndex);
 
     if (!Buffer || Buffer->GetSize() < Data.size_bytes())
@@ -114,95 +430,148 @@ void Mesh::SetPushConstantData(const std::span<const std::byte> Data)
 
 void Mesh::Tick(const float DeltaTime) {}
 
-void Mesh::Render(const VkCommandBuffer CommandBuffer, const std::uint32_t CurrentFrame) const
+void Mesh::Submit(RenderQueue& Queue, const float ViewDepth, const RenderQueue::Pass Pass) const
 {
     if (!m_Material)
     {
         return;
     }
 
-    if (CurrentFrame < Constants::ImageCount && m_UniformBuffers.at(CurrentFrame))
+    const std::uint16_t PipelineId = RenderQueue::CompactId(m_Material->GetPipeline().get());
+    const std::uint16_t MaterialId = RenderQueue::CompactId(m_Material.get());
+    const std::uint16_t GeometryId = RenderQueue::CompactId(this);
+
+    Queue.Submit(Pass == RenderQueue::Pass::Transparent
+                     ? RenderQueue::MakeTransparentKey(PipelineId, MaterialId, GeometryId, ViewDepth)
+                     : RenderQueue::MakeOpaqueKey(PipelineId, MaterialId, GeometryId, ViewDepth),
+                 *this);
+}
+
+void Mesh::Render(CommandRecorder& Recorder, const std::uint32_t CurrentFrame) const
+{
+    if (!m_Material)
     {
-        m_Material->SetUniformBuffer(m_UniformBuffers.at(CurrentFrame), 0);
+        return;
     }
 
-    m_Material->Bind(CommandBuffer);
-    const auto Pipeline     = m_Material->GetPipeline();
-    const auto PipelineType = Pipeline->GetType();
-
-    if (!std::empty(m_PushConstantData))
+    if (const std::shared_ptr<UniformArena> Arena = m_Material->GetUniformArena())
     {
-        VkShaderStageFlags Stages = 0;
-        if (const auto& Ranges = Pipeline->GetPushConstants();
-            !std::empty(Ranges))
-        {
-            for (const auto& Range : Ranges)
-            {
-                Stages |= Range.stageFlags;
-            }
-        }
-        else
+        const std::uint32_t DynamicOffset = !std::empty(m_UniformData) ? Arena->Push(m_UniformData, m_Material->GetUniformRange(), CurrentFrame) : 0U;
+        m_Material->Bind(Recorder, CurrentFrame, std::span(&DynamicOffset, 1U));
+    }
+    else
+    {
+        if (CurrentFrame < Constants::ImageCount && m_UniformBuffers.at(CurrentFrame))
         {
-            Stages = PipelineType == Pipeline::Type::Compute
-                         ? VK_SHADER_STAGE_COMPUTE_BIT
-                         : PipelineType == Pipeline::Type::Mesh
-                               ? VK_SHADER_STAGE_MESH_BIT_EXT
-                               : VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+            m_Material->SetUniformBuffer(m_UniformBuffers.at(CurrentFrame), CurrentFrame, 0);
         }
 
-        vkCmdPushConstants(CommandBuffer,
-                           Pipeline->GetPipelineLayout(),
-                           Stages,
-                           0,
-                           static_cast<std::uint32_t>(std::size(m_PushConstantData)),
-                           std::data(m_PushConstantData));
+        m_Material->Bind(Recorder, CurrentFrame);
+    }
+
+    const auto Pipeline = m_Material->GetPipeline();
+
+    if (!std::empty(m_PushConstantData))
+    {
+        Recorder.PushConstants(Pipeline->GetPipelineLayout(), Pipeline->GetPushConstantStages(), 0, m_PushConstantData);
     }
 
-    if (PipelineType == Pipeline::Type::Compute)
+    if (Pipeline->GetType() == Pipeline::Type::Compute)
     {
-        vkCmdDispatch(CommandBuffer, m_DispatchX, m_DispatchY, m_DispatchZ);
+        vkCmdDispatch(Recorder, m_DispatchX, m_DispatchY, m_DispatchZ);
         return;
     }
 
-    if (PipelineType == Pipeline::Type::Mesh)
+    const bool Conditional = m_Occlusion && m_Occlusion->BeginConditional(Recorder, m_OcclusionQuery);
+
+    RecordDraw(Recorder, CurrentFrame);
+
+    if (Conditional)
+    {
+        m_Occlusion->EndConditional(Recorder);
+    }
+}
+
+void Mesh::RenderOcclusionProxy(CommandRecorder& Recorder, const std::uint32_t CurrentFrame) const
+{
+    if (!m_Occlusion)
     {
-        if (vkCmdDrawMeshTasksEXT)
-        {
-            vkCmdDrawMeshTasksEXT(CommandBuffer, m_DispatchX, m_DispatchY, m_DispatchZ);
-        }
         return;
     }
 
-    std::vector<VkBuffer>     VtxBuffers;
-    std::vector<VkDeviceSize> Offsets;
+    if (m_OcclusionProxy)
+    {
+        m_Occlusion->RecordProxy(Recorder, m_OcclusionQuery, m_OcclusionProxy);
+    }
+    else
+    {
+        m_Occlusion->RecordProxy(Recorder, m_OcclusionQuery, m_OcclusionBounds);
+    }
+}
 
-    if (CurrentFrame < Constants::ImageCount)
+void Mesh::RecordDraw(CommandRecorder& Recorder, const std::uint32_t CurrentFrame) const
+{
+    if (m_Material->GetPipeline()->GetType() == Pipeline::Type::Mesh)
     {
-        if (m_VertexBuffers.at(CurrentFrame))
+        if (m_Meshlets)
         {
-            VtxBuffers.push_back(m_VertexBuffers.at(CurrentFrame)->GetHandle());
-            Offsets.push_back(0);
+            m_Meshlets->RecordDraw(Recorder, m_MeshletGeometry, *m_Material->GetPipeline(), m_MeshletModel, CurrentFrame);
         }
-
-        if (m_InstanceBuffers.at(CurrentFrame))
+        else if (vkCmdDrawMeshTasksEXT)
         {
-            VtxBuffers.push_back(m_InstanceBuffers.at(CurrentFrame)->GetHandle());
-            Offsets.push_back(0);
+            vkCmdDrawMeshTasksEXT(Recorder, m_DispatchX, m_DispatchY, m_DispatchZ);
         }
+        return;
+    }
+
+    if (CurrentFrame >= Constants::ImageCount)
+    {
+        return;
+    }
+
+    const bool Culled = m_Culling && m_Culling->IsTargetReady(m_CullingTarget, CurrentFrame);
+
+    std::array<VkBuffer, 2U>     VtxBuffers{};
+    std::array<VkDeviceSize, 2U> Offsets{};
+    std::uint32_t                NumBuffers = 0U;
+
+    if (const auto& VertexBuffer = m_VertexBuffers.at(CurrentFrame))
+    {
+        VtxBuffers.at(NumBuffers++) = VertexBuffer->GetHandle();
     }
 
-    if (!std::empty(VtxBuffers))
+    if (Culled)
+    {
+        VtxBuffers.at(NumBuffers++) = m_Culling->GetCompactedInstances(m_CullingTarget, CurrentFrame)->GetHandle();
+    }
+    else if (const auto& InstanceBuffer = m_InstanceBuffers.at(CurrentFrame))
     {
-        vkCmdBindVertexBuffers(CommandBuffer, 0, static_cast<std::uint32_t>(std::size(VtxBuffers)), std::data(VtxBuffers), std::data(Offsets));
+        VtxBuffers.at(NumBuffers++) = InstanceBuffer->GetHandle();
     }
 
-    if (CurrentFrame < Constants::ImageCount && m_IndexBuffers.at(CurrentFrame))
+    Recorder.BindVertexBuffers(0, std::span(std::data(VtxBuffers), NumBuffers), std::span(std::data(Offsets), NumBuffers));
+
+    const VkBuffer DrawCommand = Culled ? m_Culling->GetDrawCommand(m_CullingTarget, CurrentFrame)->GetHandle() : VK_NULL_HANDLE;
+
+    if (const auto& IndexBuffer = m_IndexBuffers.at(CurrentFrame))
+    {
+        Recorder.BindIndexBuffer(IndexBuffer->GetHandle(), 0, m_IndexType);
+
+        if (Culled)
+        {
+            vkCmdDrawIndexedIndirect(Recorder, DrawCommand, 0, 1, sizeof(VkDrawIndexedIndirectCommand));
+        }
+        else
+        {
+            vkCmdDrawIndexed(Recorder, m_IndexCount, std::max(1U, m_InstanceCount), 0, 0, 0);
+        }
+    }
+    else if (Culled)
     {
-        vkCmdBindIndexBuffer(CommandBuffer, m_IndexBuffers.at(CurrentFrame)->GetHandle(), 0, m_IndexType);
-        vkCmdDrawIndexed(CommandBuffer, m_IndexCount, std::max(1U, m_InstanceCount), 0, 0, 0);
+        vkCmdDrawIndirect(Recorder, DrawCommand, 0, 1, sizeof(VkDrawIndirectCommand));
     }
     else
     {
-        vkCmdDraw(CommandBuffer, m_VertexCount, std::max(1U, m_InstanceCount), 0, 0);
+        vkCmdDraw(Recorder, m_VertexCount, std::max(1U, m_InstanceCount), 0, 0);
     }
 }
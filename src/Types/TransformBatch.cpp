@@ -0,0 +1,783 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Types/TransformBatch.hpp"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "luvk/Modules/ThreadPool.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LUVK_TRANSFORM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LUVK_TRANSFORM_SSE
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LUVK_TRANSFORM_NEON
+#endif
+
+namespace
+{
+    constexpr float g_TwoOverPi       = 0.636619772367581343F;
+    constexpr float g_PiOverTwoHigh   = 1.5703125F;
+    constexpr float g_PiOverTwoMid    = 4.837512969970703125E-4F;
+    constexpr float g_PiOverTwoLow    = 7.54978995489188216E-8F;
+    constexpr float g_SinCoefficient1 = -1.6666654611E-1F;
+    constexpr float g_SinCoefficient2 = 8.3321608736E-3F;
+    constexpr float g_SinCoefficient3 = -1.9515295891E-4F;
+    constexpr float g_CosCoefficient1 = 4.166664568298827E-2F;
+    constexpr float g_CosCoefficient2 = -1.388731625493765E-3F;
+    constexpr float g_CosCoefficient3 = 2.443315711809948E-5F;
+
+    struct TransformView
+    {
+        const float* PositionX;
+        const float* PositionY;
+        const float* PositionZ;
+        const float* RotationX;
+        const float* RotationY;
+        const float* RotationZ;
+        const float* RotationW;
+        const float* ScaleX;
+        const float* ScaleY;
+        const float* ScaleZ;
+    };
+
+#if defined(LUVK_TRANSFORM_AVX2)
+    using Vector  = __m256;
+    using Integer = __m256i;
+    using Mask    = __m256;
+
+    constexpr std::uint32_t g_Width = 8U;
+
+    Vector Load(const float* const Source) noexcept
+    {
+        return _mm256_loadu_ps(Source);
+    }
+
+    Vector Splat(const float Value) noexcept
+    {
+        return _mm256_set1_ps(Value);
+    }
+
+    Vector Add(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm256_add_ps(Left, Right);
+    }
+
+    Vector Sub(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm256_sub_ps(Left, Right);
+    }
+
+    Vector Mul(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm256_mul_ps(Left, Right);
+    }
+
+    Vector Div(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm256_div_ps(Left, Right);
+    }
+
+    Integer RoundToInteger(const Vector Value) noexcept
+    {
+        return _mm256_cvtps_epi32(Value);
+    }
+
+    Vector ToFloat(const Integer Value) noexcept
+    {
+        return _mm256_cvtepi32_ps(Value);
+    }
+
+    Mask IsOdd(const Integer Value) noexcept
+    {
+        const __m256i One = _mm256_set1_epi32(1);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(Value, One), One));
+    }
+
+    Vector Select(const Mask Condition, const Vector IfTrue, const Vector IfFalse) noexcept
+    {
+        return _mm256_blendv_ps(IfFalse, IfTrue, Condition);
+    }
+
+    Vector ApplyQuadrantSign(const Vector Value, const Integer Quadrant) noexcept
+    {
+        const __m256i Sign = _mm256_slli_epi32(_mm256_and_si256(Quadrant, _mm256_set1_epi32(2)), 30);
+        return _mm256_xor_ps(Value, _mm256_castsi256_ps(Sign));
+    }
+
+    Integer NextQuadrant(const Integer Quadrant) noexcept
+    {
+        return _mm256_add_epi32(Quadrant, _mm256_set1_epi32(1));
+    }
+
+    void Transpose4(const __m128 Row0, const __m128 Row1, const __m128 Row2, const __m128 Row3, std::byte* const Output, const std::size_t Stride) noexcept
+    {
+        const __m128 Low01  = _mm_unpacklo_ps(Row0, Row1);
+        const __m128 High01 = _mm_unpackhi_ps(Row0, Row1);
+        const __m128 Low23  = _mm_unpacklo_ps(Row2, Row3);
+        const __m128 High23 = _mm_unpackhi_ps(Row2, Row3);
+
+        _mm_storeu_ps(reinterpret_cast<float*>(Output), _mm_movelh_ps(Low01, Low23));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride), _mm_movehl_ps(Low23, Low01));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride * 2U), _mm_movelh_ps(High01, High23));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride * 3U), _mm_movehl_ps(High23, High01));
+    }
+
+    void StoreColumns(const Vector First, const Vector Second, const Vector Third, const Vector Fourth, std::byte* const Output, const std::size_t Stride) noexcept
+    {
+        Transpose4(_mm256_castps256_ps128(First),
+                   _mm256_castps256_ps128(Second),
+                   _mm256_castps256_ps128(Third),
+                   _mm256_castps256_ps128(Fourth),
+                   Output,
+                   Stride);
+
+        Transpose4(_mm256_extractf128_ps(First, 1),
+                   _mm256_extractf128_ps(Second, 1),
+                   _mm256_extractf128_ps(Third, 1),
+                   _mm256_extractf128_ps(Fourth, 1),
+                   Output + Stride * 4U,
+                   Stride);
+    }
+#elif defined(LUVK_TRANSFORM_SSE)
+    using Vector  = __m128;
+    using Integer = __m128i;
+    using Mask    = __m128;
+
+    constexpr std::uint32_t g_Width = 4U;
+
+    Vector Load(const float* const Source) noexcept
+    {
+        return _mm_loadu_ps(Source);
+    }
+
+    Vector Splat(const float Value) noexcept
+    {
+        return _mm_set1_ps(Value);
+    }
+
+    Vector Add(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm_add_ps(Left, Right);
+    }
+
+    Vector Sub(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm_sub_ps(Left, Right);
+    }
+
+    Vector Mul(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm_mul_ps(Left, Right);
+    }
+
+    Vector Div(const Vector Left, const Vector Right) noexcept
+    {
+        return _mm_div_ps(Left, Right);
+    }
+
+    Integer RoundToInteger(const Vector Value) noexcept
+    {
+        return _mm_cvtps_epi32(Value);
+    }
+
+    Vector ToFloat(const Integer Value) noexcept
+    {
+        return _mm_cvtepi32_ps(Value);
+    }
+
+    Mask IsOdd(const Integer Value) noexcept
+    {
+        const __m128i One = _mm_set1_epi32(1);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(Value, One), One));
+    }
+
+    Vector Select(const Mask Condition, const Vector IfTrue, const Vector IfFalse) noexcept
+    {
+        return _mm_or_ps(_mm_and_ps(Condition, IfTrue), _mm_andnot_ps(Condition, IfFalse));
+    }
+
+    Vector ApplyQuadrantSign(const Vector Value, const Integer Quadrant) noexcept
+    {
+        const __m128i Sign = _mm_slli_epi32(_mm_and_si128(Quadrant, _mm_set1_epi32(2)), 30);
+        return _mm_xor_ps(Value, _mm_castsi128_ps(Sign));
+    }
+
+    Integer NextQuadrant(const Integer Quadrant) noexcept
+    {
+        return _mm_add_epi32(Quadrant, _mm_set1_epi32(1));
+    }
+
+    void StoreColumns(const Vector First, const Vector Second, const Vector Third, const Vector Fourth, std::byte* const Output, const std::size_t Stride) noexcept
+    {
+        const __m128 Low01  = _mm_unpacklo_ps(First, Second);
+        const __m128 High01 = _mm_unpackhi_ps(First, Second);
+        const __m128 Low23  = _mm_unpacklo_ps(Third, Fourth);
+        const __m128 High23 = _mm_unpackhi_ps(Third, Fourth);
+
+        _mm_storeu_ps(reinterpret_cast<float*>(Output), _mm_movelh_ps(Low01, Low23));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride), _mm_movehl_ps(Low23, Low01));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride * 2U), _mm_movelh_ps(High01, High23));
+        _mm_storeu_ps(reinterpret_cast<float*>(Output + Stride * 3U), _mm_movehl_ps(High23, High01));
+    }
+#elif defined(LUVK_TRANSFORM_NEON)
+    using Vector  = float32x4_t;
+    using Integer = int32x4_t;
+    using Mask    = uint32x4_t;
+
+    constexpr std::uint32_t g_Width = 4U;
+
+    Vector Load(const float* const Source) noexcept
+    {
+        return vld1q_f32(Source);
+    }
+
+    Vector Splat(const float Value) noexcept
+    {
+        return vdupq_n_f32(Value);
+    }
+
+    Vector Add(const Vector Left, const Vector Right) noexcept
+    {
+        return vaddq_f32(Left, Right);
+    }
+
+    Vector Sub(const Vector Left, const Vector Right) noexcept
+    {
+        return vsubq_f32(Left, Right);
+    }
+
+    Vector Mul(const Vector Left, const Vector Right) noexcept
+    {
+        return vmulq_f32(Left, Right);
+    }
+
+    Vector Div(const Vector Left, const Vector Right) noexcept
+    {
+        return vdivq_f32(Left, Right);
+    }
+
+    Integer RoundToInteger(const Vector Value) noexcept
+    {
+        return vcvtnq_s32_f32(Value);
+    }
+
+    Vector ToFloat(const Integer Value) noexcept
+    {
+        return vcvtq_f32_s32(Value);
+    }
+
+    Mask IsOdd(const Integer Value) noexcept
+    {
+        return vtstq_s32(Value, vdupq_n_s32(1));
+    }
+
+    Vector Select(const Mask Condition, const Vector IfTrue, const Vector IfFalse) noexcept
+    {
+        return vbslq_f32(Condition, IfTrue, IfFalse);
+    }
+
+    Vector ApplyQuadrantSign(const Vector Value, const Integer Quadrant) noexcept
+    {
+        const uint32x4_t Sign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(Quadrant), vdupq_n_u32(2U)), 30);
+        return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(Value), Sign));
+    }
+
+    Integer NextQuadrant(const Integer Quadrant) noexcept
+    {
+        return vaddq_s32(Quadrant, vdupq_n_s32(1));
+    }
+
+    void StoreColumns(const Vector First, const Vector Second, const Vector Third, const Vector Fourth, std::byte* const Output, const std::size_t Stride) noexcept
+    {
+        const float32x4x2_t Low  = vtrnq_f32(First, Second);
+        const float32x4x2_t High = vtrnq_f32(Third, Fourth);
+
+        vst1q_f32(reinterpret_cast<float*>(Output), vcombine_f32(vget_low_f32(Low.val[0]), vget_low_f32(High.val[0])));
+        vst1q_f32(reinterpret_cast<float*>(Output + Stride), vcombine_f32(vget_low_f32(Low.val[1]), vget_low_f32(High.val[1])));
+        vst1q_f32(reinterpret_cast<float*>(Output + Stride * 2U), vcombine_f32(vget_high_f32(Low.val[0]), vget_high_f32(High.val[0])));
+        vst1q_f32(reinterpret_cast<float*>(Output + Stride * 3U), vcombine_f32(vget_high_f32(Low.val[1]), vget_high_f32(High.val[1])));
+    }
+#else
+    using Vector  = float;
+    using Integer = std::int32_t;
+    using Mask    = bool;
+
+    constexpr std::uint32_t g_Width = 1U;
+
+    Vector Load(const float* const Source) noexcept
+    {
+        return *Source;
+    }
+
+    Vector Splat(const float Value) noexcept
+    {
+        return Value;
+    }
+
+    Vector Add(const Vector Left, const Vector Right) noexcept
+    {
+        return Left + Right;
+    }
+
+    Vector Sub(const Vector Left, const Vector Right) noexcept
+    {
+        return Left - Right;
+    }
+
+    Vector Mul(const Vector Left, const Vector Right) noexcept
+    {
+        return Left * Right;
+    }
+
+    Vector Div(const Vector Left, const Vector Right) noexcept
+    {
+        return Left / Right;
+    }
+
+    Integer RoundToInteger(const Vector Value) noexcept
+    {
+        return static_cast<Integer>(std::nearbyint(Value));
+    }
+
+    Vector ToFloat(const Integer Value) noexcept
+    {
+        return static_cast<Vector>(Value);
+    }
+
+    Mask IsOdd(const Integer Value) noexcept
+    {
+        return (Value & 1) != 0;
+    }
+
+    Vector Select(const Mask Condition, const Vector IfTrue, const Vector IfFalse) noexcept
+    {
+        return Condition ? IfTrue : IfFalse;
+    }
+
+    Vector ApplyQuadrantSign(const Vector Value, const Integer Quadrant) noexcept
+    {
+        return (Quadrant & 2) != 0 ? -Value : Value;
+    }
+
+    Integer NextQuadrant(const Integer Quadrant) noexcept
+    {
+        return Quadrant + 1;
+    }
+
+    void StoreColumns(const Vector First, const Vector Second, const Vector Third, const Vector Fourth, std::byte* const Output, [[maybe_unused]] const std::size_t Stride) noexcept
+    {
+        const std::array Values{First, Second, Third, Fourth};
+        std::memcpy(Output, std::data(Values), sizeof(Values));
+    }
+#endif
+
+    static_assert(luvk::TransformBatch::BlockSize % g_Width == 0U);
+
+    struct RotationMatrix
+    {
+        Vector M00;
+        Vector M01;
+        Vector M02;
+        Vector M10;
+        Vector M11;
+        Vector M12;
+        Vector M20;
+        Vector M21;
+        Vector M22;
+    };
+
+    void SinCos(const Vector Angle, Vector& Sin, Vector& Cos) noexcept
+    {
+        const Integer Quadrant = RoundToInteger(Mul(Angle, Splat(g_TwoOverPi)));
+        const Vector  Steps    = ToFloat(Quadrant);
+
+        Vector Reduced = Sub(Angle, Mul(Steps, Splat(g_PiOverTwoHigh)));
+        Reduced        = Sub(Reduced, Mul(Steps, Splat(g_PiOverTwoMid)));
+        Reduced        = Sub(Reduced, Mul(Steps, Splat(g_PiOverTwoLow)));
+
+        const Vector Square = Mul(Reduced, Reduced);
+
+        Vector SinPolynomial = Add(Splat(g_SinCoefficient2), Mul(Square, Splat(g_SinCoefficient3)));
+        SinPolynomial        = Add(Splat(g_SinCoefficient1), Mul(Square, SinPolynomial));
+        SinPolynomial        = Add(Reduced, Mul(Mul(Reduced, Square), SinPolynomial));
+
+        Vector CosPolynomial = Add(Splat(g_CosCoefficient2), Mul(Square, Splat(g_CosCoefficient3)));
+        CosPolynomial        = Add(Splat(g_CosCoefficient1), Mul(Square, CosPolynomial));
+        CosPolynomial        = Add(Sub(Splat(1.F), Mul(Square, Splat(0.5F))), Mul(Mul(Square, Square), CosPolynomial));
+
+        const Mask Swap = IsOdd(Quadrant);
+
+        Sin = ApplyQuadrantSign(Select(Swap, CosPolynomial, SinPolynomial), Quadrant);
+        Cos = ApplyQuadrantSign(Select(Swap, SinPolynomial, CosPolynomial), NextQuadrant(Quadrant));
+    }
+
+    RotationMatrix EulerRotation(const TransformView& View, const std::uint32_t Index) noexcept
+    {
+        Vector SinX;
+        Vector CosX;
+        Vector SinY;
+        Vector CosY;
+        Vector SinZ;
+        Vector CosZ;
+
+        SinCos(Load(View.RotationX + Index), SinX, CosX);
+        SinCos(Load(View.RotationY + Index), SinY, CosY);
+        SinCos(Load(View.RotationZ + Index), SinZ, CosZ);
+
+        const Vector SinXSinY = Mul(SinX, SinY);
+        const Vector CosXSinY = Mul(CosX, SinY);
+
+        return {Mul(CosY, CosZ),
+                Sub(Mul(SinXSinY, CosZ), Mul(CosX, SinZ)),
+                Add(Mul(CosXSinY, CosZ), Mul(SinX, SinZ)),
+                Mul(CosY, SinZ),
+                Add(Mul(SinXSinY, SinZ), Mul(CosX, CosZ)),
+                Sub(Mul(CosXSinY, SinZ), Mul(SinX, CosZ)),
+                Sub(Splat(0.F), SinY),
+                Mul(SinX, CosY),
+                Mul(CosX, CosY)};
+    }
+
+    RotationMatrix QuaternionRotation(const TransformView& View, const std::uint32_t Index) noexcept
+    {
+        const Vector X = Load(View.RotationX + Index);
+        const Vector Y = Load(View.RotationY + Index);
+        const Vector Z = Load(View.RotationZ + Index);
+        const Vector W = Load(View.RotationW + Index);
+
+        const Vector LengthSquared = Add(Add(Mul(X, X), Mul(Y, Y)), Add(Mul(Z, Z), Mul(W, W)));
+        const Vector Factor        = Div(Splat(2.F), LengthSquared);
+
+        const Vector XX = Mul(X, Mul(X, Factor));
+        const Vector YY = Mul(Y, Mul(Y, Factor));
+        const Vector ZZ = Mul(Z, Mul(Z, Factor));
+        const Vector XY = Mul(X, Mul(Y, Factor));
+        const Vector XZ = Mul(X, Mul(Z, Factor));
+        const Vector YZ = Mul(Y, Mul(Z, Factor));
+        const Vector WX = Mul(W, Mul(X, Factor));
+        const Vector WY = Mul(W, Mul(Y, Factor));
+        const Vector WZ = Mul(W, Mul(Z, Factor));
+        const Vector One = Splat(1.F);
+
+        return {Sub(One, Add(YY, ZZ)),
+                Sub(XY, WZ),
+                Add(XZ, WY),
+                Add(XY, WZ),
+                Sub(One, Add(XX, ZZ)),
+                Sub(YZ, WX),
+                Sub(XZ, WY),
+                Add(YZ, WX),
+                Sub(One, Add(XX, YY))};
+    }
+
+    void BuildBlock(const TransformView&                     View,
+                    const luvk::TransformBatch::RotationMode Mode,
+                    const luvk::TransformBatch::MatrixLayout Layout,
+                    const std::uint32_t                      Index,
+                    std::byte* const                         Output,
+                    const std::size_t                        Stride) noexcept
+    {
+        const RotationMatrix Rotation = Mode == luvk::TransformBatch::RotationMode::Euler
+                                            ? EulerRotation(View, Index)
+                                            : QuaternionRotation(View, Index);
+
+        const Vector PositionX = Load(View.PositionX + Index);
+        const Vector PositionY = Load(View.PositionY + Index);
+        const Vector PositionZ = Load(View.PositionZ + Index);
+        const Vector ScaleX    = Load(View.ScaleX + Index);
+        const Vector ScaleY    = Load(View.ScaleY + Index);
+        const Vector ScaleZ    = Load(View.ScaleZ + Index);
+
+        constexpr std::size_t Row = sizeof(float) * 4U;
+
+        if (Layout == luvk::TransformBatch::MatrixLayout::Affine3x4)
+        {
+            StoreColumns(Mul(Rotation.M00, ScaleX), Mul(Rotation.M01, ScaleY), Mul(Rotation.M02, ScaleZ), PositionX, Output, Stride);
+            StoreColumns(Mul(Rotation.M10, ScaleX), Mul(Rotation.M11, ScaleY), Mul(Rotation.M12, ScaleZ), PositionY, Output + Row, Stride);
+            StoreColumns(Mul(Rotation.M20, ScaleX), Mul(Rotation.M21, ScaleY), Mul(Rotation.M22, ScaleZ), PositionZ, Output + Row * 2U, Stride);
+            return;
+        }
+
+        const Vector Zero = Splat(0.F);
+
+        StoreColumns(Mul(Rotation.M00, ScaleX), Mul(Rotation.M10, ScaleX), Mul(Rotation.M20, ScaleX), Zero, Output, Stride);
+        StoreColumns(Mul(Rotation.M01, ScaleY), Mul(Rotation.M11, ScaleY), Mul(Rotation.M21, ScaleY), Zero, Output + Row, Stride);
+        StoreColumns(Mul(Rotation.M02, ScaleZ), Mul(Rotation.M12, ScaleZ), Mul(Rotation.M22, ScaleZ), Zero, Output + Row * 2U, Stride);
+        StoreColumns(PositionX, PositionY, PositionZ, Splat(1.F), Output + Row * 3U, Stride);
+    }
+
+    std::array<float, 4> EulerToQuaternion(const std::array<float, 3>& Euler) noexcept
+    {
+        const float SinX = std::sin(Euler.at(0U) * 0.5F);
+        const float CosX = std::cos(Euler.at(0U) * 0.5F);
+        const float SinY = std::sin(Euler.at(1U) * 0.5F);
+        const float CosY = std::cos(Euler.at(1U) * 0.5F);
+        const float SinZ = std::sin(Euler.at(2U) * 0.5F);
+        const float CosZ = std::cos(Euler.at(2U) * 0.5F);
+
+        return {SinX * CosY * CosZ - CosX * SinY * SinZ,
+                CosX * SinY * CosZ + SinX * CosY * SinZ,
+                CosX * CosY * SinZ - SinX * SinY * CosZ,
+                CosX * CosY * CosZ + SinX * SinY * SinZ};
+    }
+} // namespace
+
+luvk::TransformBatch::TransformBatch(const RotationMode Mode, const std::shared_ptr<ThreadPool>& ThreadPoolModule)
+    : m_RotationMode(Mode),
+      m_ThreadPoolModule(ThreadPoolModule) {}
+
+void luvk::TransformBatch::Reserve(const std::size_t Count)
+{
+    for (std::vector<float>* ArrayIt : {&m_PositionX, &m_PositionY, &m_PositionZ,
+                                        &m_RotationX, &m_RotationY, &m_RotationZ, &m_RotationW,
+                                        &m_ScaleX, &m_ScaleY, &m_ScaleZ})
+    {
+        ArrayIt->reserve(Count);
+    }
+}
+
+void luvk::TransformBatch::Resize(const std::size_t Count)
+{
+    for (std::vector<float>* ArrayIt : {&m_PositionX, &m_PositionY, &m_PositionZ, &m_RotationX, &m_RotationY, &m_RotationZ})
+    {
+        ArrayIt->resize(Count, 0.F);
+    }
+
+    for (std::vector<float>* ArrayIt : {&m_RotationW, &m_ScaleX, &m_ScaleY, &m_ScaleZ})
+    {
+        ArrayIt->resize(Count, 1.F);
+    }
+}
+
+void luvk::TransformBatch::Clear() noexcept
+{
+    for (std::vector<float>* ArrayIt : {&m_PositionX, &m_PositionY, &m_PositionZ,
+                                        &m_RotationX, &m_RotationY, &m_RotationZ, &m_RotationW,
+                                        &m_ScaleX, &m_ScaleY, &m_ScaleZ})
+    {
+        ArrayIt->clear();
+    }
+}
+
+std::uint32_t luvk::TransformBatch::Add(const Transform& Value)
+{
+    const auto Index = static_cast<std::uint32_t>(GetCount());
+    Resize(GetCount() + 1U);
+    Set(Index, Value);
+    return Index;
+}
+
+std::uint32_t luvk::TransformBatch::Add(const std::array<float, 3>& Position, const std::array<float, 4>& Rotation, const std::array<float, 3>& Scale)
+{
+    const auto Index = static_cast<std::uint32_t>(GetCount());
+    Resize(GetCount() + 1U);
+    Set(Index, Position, Rotation, Scale);
+    return Index;
+}
+
+void luvk::TransformBatch::Set(const std::uint32_t Index, const Transform& Value)
+{
+    if (m_RotationMode == RotationMode::Quaternion)
+    {
+        Set(Index, Value.Position, EulerToQuaternion(Value.Rotation), Value.Scale);
+        return;
+    }
+
+    SetPosition(Index, Value.Position);
+    SetScale(Index, Value.Scale);
+
+    m_RotationX.at(Index) = Value.Rotation.at(0U);
+    m_RotationY.at(Index) = Value.Rotation.at(1U);
+    m_RotationZ.at(Index) = Value.Rotation.at(2U);
+    m_RotationW.at(Index) = 1.F;
+}
+
+void luvk::TransformBatch::Set(const std::uint32_t         Index,
+                               const std::array<float, 3>& Position,
+                               const std::array<float, 4>& Rotation,
+                               const std::array<float, 3>& Scale)
+{
+    if (m_RotationMode != RotationMode::Quaternion)
+    {
+        throw std::runtime_error("Quaternion rotations require a quaternion transform batch.");
+    }
+
+    SetPosition(Index, Position);
+    SetScale(Index, Scale);
+
+    m_RotationX.at(Index) = Rotation.at(0U);
+    m_RotationY.at(Index) = Rotation.at(1U);
+    m_RotationZ.at(Index) = Rotation.at(2U);
+    m_RotationW.at(Index) = Rotation.at(3U);
+}
+
+void luvk::TransformBatch::SetPosition(const std::uint32_t Index, const std::array<float, 3>& Position)
+{
+    m_PositionX.at(Index) = Position.at(0U);
+    m_PositionY.at(Index) = Position.at(1U);
+    m_PositionZ.at(Index) = Position.at(2U);
+}
+
+void luvk::TransformBatch::SetScale(const std::uint32_t Index, const std::array<float, 3>& Scale)
+{
+    m_ScaleX.at(Index) = Scale.at(0U);
+    m_ScaleY.at(Index) = Scale.at(1U);
+    m_ScaleZ.at(Index) = Scale.at(2U);
+}
+
+void luvk::TransformBatch::Build(const std::span<std::byte> Output, const MatrixLayout Layout, std::size_t Stride) const
+{
+    const auto        Count      = static_cast<std::uint32_t>(GetCount());
+    const std::size_t MatrixSize = GetMatrixSize(Layout);
+
+    if (Stride == 0U)
+    {
+        Stride = MatrixSize;
+    }
+
+    if (Stride < MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix stride is smaller than the matrix size.");
+    }
+
+    if (Count == 0U)
+    {
+        return;
+    }
+
+    if (std::size(Output) < Stride * (Count - 1U) + MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix output is too small for the batch.");
+    }
+
+    ParallelFor(m_ThreadPoolModule.get(),
+                Count,
+                GetParallelChunk(m_ThreadPoolModule.get(), Count, m_MinTransformsPerTask, BlockSize),
+                [&](const std::uint32_t Begin, const std::uint32_t End)
+                {
+                    BuildBlocks(Begin, End, std::data(Output) + Begin * Stride, Layout, Stride);
+                });
+}
+
+void luvk::TransformBatch::BuildRange(const std::uint32_t        Begin,
+                                      const std::uint32_t        End,
+                                      const std::span<std::byte> Output,
+                                      const MatrixLayout         Layout,
+                                      std::size_t                Stride) const
+{
+    const std::size_t MatrixSize = GetMatrixSize(Layout);
+
+    if (Stride == 0U)
+    {
+        Stride = MatrixSize;
+    }
+
+    if (Stride < MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix stride is smaller than the matrix size.");
+    }
+
+    if (End > GetCount() || Begin > End)
+    {
+        throw std::runtime_error("Transform range exceeds the batch.");
+    }
+
+    if (Begin == End)
+    {
+        return;
+    }
+
+    if (std::size(Output) < Stride * (End - Begin - 1U) + MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix output is too small for the range.");
+    }
+
+    BuildBlocks(Begin, End, std::data(Output), Layout, Stride);
+}
+
+std::string_view luvk::TransformBatch::GetBackendName() noexcept
+{
+#if defined(LUVK_TRANSFORM_AVX2)
+    return "AVX2";
+#elif defined(LUVK_TRANSFORM_SSE)
+    return "SSE2";
+#elif defined(LUVK_TRANSFORM_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+void luvk::TransformBatch::BuildBlocks(const std::uint32_t Begin,
+                                       const std::uint32_t End,
+                                       std::byte* const    Output,
+                                       const MatrixLayout  Layout,
+                                       const std::size_t   Stride) const noexcept
+{
+    const TransformView View{.PositionX = std::data(m_PositionX),
+                             .PositionY = std::data(m_PositionY),
+                             .PositionZ = std::data(m_PositionZ),
+                             .RotationX = std::data(m_RotationX),
+                             .RotationY = std::data(m_RotationY),
+                             .RotationZ = std::data(m_RotationZ),
+                             .RotationW = std::data(m_RotationW),
+                             .ScaleX = std::data(m_ScaleX),
+                             .ScaleY = std::data(m_ScaleY),
+                             .ScaleZ = std::data(m_ScaleZ)};
+
+    std::uint32_t Index = Begin;
+
+    for (; Index + g_Width <= End; Index += g_Width)
+    {
+        BuildBlock(View, m_RotationMode, Layout, Index, Output + (Index - Begin) * Stride, Stride);
+    }
+
+    if (Index == End)
+    {
+        return;
+    }
+
+    const std::uint32_t Remaining = End - Index;
+
+    std::array<std::array<float, g_Width>, 10> Tail{};
+    std::array<std::byte, g_Width * sizeof(float) * 16U> Matrices{};
+
+    for (std::size_t Component = 6U; Component < std::size(Tail); ++Component)
+    {
+        Tail.at(Component).fill(1.F);
+    }
+
+    const std::array Sources{View.PositionX, View.PositionY, View.PositionZ,
+                             View.RotationX, View.RotationY, View.RotationZ, View.RotationW,
+                             View.ScaleX, View.ScaleY, View.ScaleZ};
+
+    for (std::size_t Component = 0U; Component < std::size(Tail); ++Component)
+    {
+        std::copy_n(Sources.at(Component) + Index, Remaining, std::data(Tail.at(Component)));
+    }
+
+    const TransformView TailView{.PositionX = std::data(Tail[0]),
+                                 .PositionY = std::data(Tail[1]),
+                                 .PositionZ = std::data(Tail[2]),
+                                 .RotationX = std::data(Tail[3]),
+                                 .RotationY = std::data(Tail[4]),
+                                 .RotationZ = std::data(Tail[5]),
+                                 .RotationW = std::data(Tail[6]),
+                                 .ScaleX = std::data(Tail[7]),
+                                 .ScaleY = std::data(Tail[8]),
+                                 .ScaleZ = std::data(Tail[9])};
+
+    const std::size_t MatrixSize = GetMatrixSize(Layout);
+    BuildBlock(TailView, m_RotationMode, Layout, 0U, std::data(Matrices), MatrixSize);
+
+    for (std::uint32_t Lane = 0U; Lane < Remaining; ++Lane)
+    {
+        std::memcpy(Output + (Index - Begin + Lane) * Stride, std::data(Matrices) + Lane * MatrixSize, MatrixSize);
+    }
+}
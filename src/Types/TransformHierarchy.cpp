@@ -0,0 +1,379 @@
+// Author: Lucas Vilas-Boas
+// Year: 2025
+// Repo : https://github.com/lucoiso/luvk
+
+#include "luvk/Types/TransformHierarchy.hpp"
+#include <cstring>
+#include <stdexcept>
+#include "luvk/Modules/ThreadPool.hpp"
+
+namespace
+{
+    luvk::TransformHierarchy::Matrix Multiply(const luvk::TransformHierarchy::Matrix& Parent, const luvk::TransformHierarchy::Matrix& Local) noexcept
+    {
+        luvk::TransformHierarchy::Matrix Output{};
+
+        for (std::size_t Row = 0U; Row < 3U; ++Row)
+        {
+            const float Row0 = Parent[Row * 4U];
+            const float Row1 = Parent[Row * 4U + 1U];
+            const float Row2 = Parent[Row * 4U + 2U];
+
+            for (std::size_t Column = 0U; Column < 4U; ++Column)
+            {
+                Output[Row * 4U + Column] = Row0 * Local[Column] + Row1 * Local[4U + Column] + Row2 * Local[8U + Column];
+            }
+
+            Output[Row * 4U + 3U] += Parent[Row * 4U + 3U];
+        }
+
+        return Output;
+    }
+} // namespace
+
+luvk::TransformHierarchy::TransformHierarchy(const TransformBatch::RotationMode Mode, const std::shared_ptr<ThreadPool>& ThreadPoolModule)
+    : m_Locals(Mode),
+      m_ThreadPoolModule(ThreadPoolModule) {}
+
+void luvk::TransformHierarchy::Reserve(const std::size_t Count)
+{
+    m_Locals.Reserve(Count);
+    m_Parents.reserve(Count);
+    m_LocalDirty.reserve(Count);
+    m_LocalMatrices.reserve(Count);
+    m_Order.reserve(Count);
+    m_Slots.reserve(Count);
+    m_OrderParents.reserve(Count);
+    m_WorldDirty.reserve(Count);
+    m_World.reserve(Count);
+}
+
+void luvk::TransformHierarchy::Clear() noexcept
+{
+    m_Locals.Clear();
+    m_Parents.clear();
+    m_LocalDirty.clear();
+    m_LocalMatrices.clear();
+    m_Order.clear();
+    m_Slots.clear();
+    m_OrderParents.clear();
+    m_Levels.clear();
+    m_WorldDirty.clear();
+    m_World.clear();
+
+    m_TopologyDirty = false;
+    m_LocalChanged  = false;
+    m_UpdatedCount  = 0U;
+}
+
+std::uint32_t luvk::TransformHierarchy::AddNode(const std::uint32_t Parent, const Transform& Local)
+{
+    if (Parent != InvalidNode && Parent >= GetCount())
+    {
+        throw std::runtime_error("Transform parent does not exist.");
+    }
+
+    const std::uint32_t Node = m_Locals.Add(Local);
+
+    m_Parents.push_back(Parent);
+    m_LocalDirty.push_back(1U);
+    m_LocalMatrices.emplace_back();
+
+    m_TopologyDirty = true;
+    m_LocalChanged  = true;
+
+    return Node;
+}
+
+void luvk::TransformHierarchy::SetParent(const std::uint32_t Node, const std::uint32_t Parent)
+{
+    if (Node >= GetCount() || (Parent != InvalidNode && Parent >= GetCount()))
+    {
+        throw std::runtime_error("Transform node does not exist.");
+    }
+
+    for (std::uint32_t Ancestor = Parent; Ancestor != InvalidNode; Ancestor = m_Parents.at(Ancestor))
+    {
+        if (Ancestor == Node)
+        {
+            throw std::runtime_error("Transform parent would create a cycle.");
+        }
+    }
+
+    m_Parents.at(Node) = Parent;
+    m_TopologyDirty    = true;
+}
+
+void luvk::TransformHierarchy::SetLocal(const std::uint32_t Node, const Transform& Local)
+{
+    m_Locals.Set(Node, Local);
+    MarkLocalDirty(Node);
+}
+
+void luvk::TransformHierarchy::SetLocal(const std::uint32_t         Node,
+                                        const std::array<float, 3>& Position,
+                                        const std::array<float, 4>& Rotation,
+                                        const std::array<float, 3>& Scale)
+{
+    m_Locals.Set(Node, Position, Rotation, Scale);
+    MarkLocalDirty(Node);
+}
+
+void luvk::TransformHierarchy::SetPosition(const std::uint32_t Node, const std::array<float, 3>& Position)
+{
+    m_Locals.SetPosition(Node, Position);
+    MarkLocalDirty(Node);
+}
+
+void luvk::TransformHierarchy::SetScale(const std::uint32_t Node, const std::array<float, 3>& Scale)
+{
+    m_Locals.SetScale(Node, Scale);
+    MarkLocalDirty(Node);
+}
+
+std::uint32_t luvk::TransformHierarchy::Update()
+{
+    m_UpdatedCount = 0U;
+
+    if (!m_TopologyDirty && !m_LocalChanged)
+    {
+        return 0U;
+    }
+
+    if (m_TopologyDirty)
+    {
+        RebuildOrder();
+    }
+
+    UpdateLocalMatrices();
+    UpdateWorldMatrices();
+
+    std::ranges::fill(m_LocalDirty, 0U);
+    std::ranges::fill(m_WorldDirty, 0U);
+
+    m_TopologyDirty = false;
+    m_LocalChanged  = false;
+
+    return m_UpdatedCount;
+}
+
+void luvk::TransformHierarchy::Build(const std::span<std::byte> Output, const TransformBatch::MatrixLayout Layout, std::size_t Stride) const
+{
+    const auto        Count      = static_cast<std::uint32_t>(GetCount());
+    const std::size_t MatrixSize = TransformBatch::GetMatrixSize(Layout);
+
+    if (m_TopologyDirty || m_LocalChanged)
+    {
+        throw std::runtime_error("Transform hierarchy must be updated before building matrices.");
+    }
+
+    if (Stride == 0U)
+    {
+        Stride = MatrixSize;
+    }
+
+    if (Stride < MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix stride is smaller than the matrix size.");
+    }
+
+    if (Count == 0U)
+    {
+        return;
+    }
+
+    if (std::size(Output) < Stride * (Count - 1U) + MatrixSize)
+    {
+        throw std::runtime_error("Transform matrix output is too small for the hierarchy.");
+    }
+
+    ParallelFor(m_ThreadPoolModule.get(),
+                Count,
+                GetParallelChunk(m_ThreadPoolModule.get(), Count, m_MinNodesPerTask, TransformBatch::BlockSize),
+                [&](const std::uint32_t Begin, const std::uint32_t End)
+                {
+                    for (std::uint32_t Node = Begin; Node < End; ++Node)
+                    {
+                        const Matrix&    World       = m_World[m_Slots[Node]];
+                        std::byte* const Destination = std::data(Output) + Node * Stride;
+
+                        if (Layout == TransformBatch::MatrixLayout::Affine3x4)
+                        {
+                            std::memcpy(Destination, std::data(World), sizeof(Matrix));
+                            continue;
+                        }
+
+                        const std::array<float, 16> Columns{World[0], World[4], World[8], 0.F,
+                                                            World[1], World[5], World[9], 0.F,
+                                                            World[2], World[6], World[10], 0.F,
+                                                            World[3], World[7], World[11], 1.F};
+
+                        std::memcpy(Destination, std::data(Columns), sizeof(Columns));
+                    }
+                });
+}
+
+const luvk::TransformHierarchy::Matrix& luvk::TransformHierarchy::GetWorldMatrix(const std::uint32_t Node) const
+{
+    if (m_TopologyDirty || m_LocalChanged)
+    {
+        throw std::runtime_error("Transform hierarchy must be updated before reading world matrices.");
+    }
+
+    return m_World.at(m_Slots.at(Node));
+}
+
+void luvk::TransformHierarchy::MarkLocalDirty(const std::uint32_t Node)
+{
+    m_LocalDirty.at(Node) = 1U;
+    m_LocalChanged        = true;
+}
+
+void luvk::TransformHierarchy::RebuildOrder()
+{
+    const auto Count = static_cast<std::uint32_t>(GetCount());
+
+    std::vector<std::uint32_t> FirstChild(Count + 1U, 0U);
+
+    for (const std::uint32_t ParentIt : m_Parents)
+    {
+        if (ParentIt != InvalidNode)
+        {
+            ++FirstChild.at(ParentIt + 1U);
+        }
+    }
+
+    for (std::uint32_t Node = 0U; Node < Count; ++Node)
+    {
+        FirstChild.at(Node + 1U) += FirstChild.at(Node);
+    }
+
+    std::vector<std::uint32_t> Children(FirstChild.back());
+    std::vector<std::uint32_t> Cursor(std::begin(FirstChild), std::prev(std::end(FirstChild)));
+
+    m_Order.clear();
+
+    for (std::uint32_t Node = 0U; Node < Count; ++Node)
+    {
+        if (const std::uint32_t Parent = m_Parents.at(Node);
+            Parent == InvalidNode)
+        {
+            m_Order.push_back(Node);
+        }
+        else
+        {
+            Children.at(Cursor.at(Parent)++) = Node;
+        }
+    }
+
+    m_Levels.assign(1U, 0U);
+
+    for (std::size_t LevelBegin = 0U; LevelBegin < std::size(m_Order);)
+    {
+        const std::size_t LevelEnd = std::size(m_Order);
+
+        for (std::size_t Index = LevelBegin; Index < LevelEnd; ++Index)
+        {
+            const std::uint32_t Node = m_Order.at(Index);
+            m_Order.insert(std::end(m_Order), std::begin(Children) + FirstChild.at(Node), std::begin(Children) + FirstChild.at(Node + 1U));
+        }
+
+        m_Levels.push_back(static_cast<std::uint32_t>(LevelEnd));
+        LevelBegin = LevelEnd;
+    }
+
+    if (std::size(m_Order) != Count)
+    {
+        throw std::runtime_error("Transform hierarchy contains a cycle.");
+    }
+
+    m_Slots.resize(Count);
+    m_OrderParents.resize(Count);
+
+    for (std::uint32_t Slot = 0U; Slot < Count; ++Slot)
+    {
+        m_Slots.at(m_Order.at(Slot)) = Slot;
+    }
+
+    for (std::uint32_t Slot = 0U; Slot < Count; ++Slot)
+    {
+        const std::uint32_t Parent = m_Parents.at(m_Order.at(Slot));
+        m_OrderParents.at(Slot)    = Parent == InvalidNode ? InvalidNode : m_Slots.at(Parent);
+    }
+
+    m_World.resize(Count);
+    m_WorldDirty.assign(Count, 1U);
+}
+
+void luvk::TransformHierarchy::UpdateLocalMatrices()
+{
+    const std::span<std::byte> Locals = std::as_writable_bytes(std::span(m_LocalMatrices));
+    const auto                 Count  = static_cast<std::uint32_t>(GetCount());
+
+    ParallelFor(m_ThreadPoolModule.get(),
+                Count,
+                GetParallelChunk(m_ThreadPoolModule.get(), Count, m_MinNodesPerTask, TransformBatch::BlockSize),
+                [&](const std::uint32_t Begin, const std::uint32_t End)
+                {
+                    for (std::uint32_t RunBegin = Begin; RunBegin < End;)
+                    {
+                        if (m_LocalDirty[RunBegin] == 0U)
+                        {
+                            ++RunBegin;
+                            continue;
+                        }
+
+                        std::uint32_t RunEnd = RunBegin + 1U;
+
+                        while (RunEnd < End && m_LocalDirty[RunEnd] != 0U)
+                        {
+                            ++RunEnd;
+                        }
+
+                        m_Locals.BuildRange(RunBegin,
+                                            RunEnd,
+                                            Locals.subspan(RunBegin * sizeof(Matrix), (RunEnd - RunBegin) * sizeof(Matrix)),
+                                            TransformBatch::MatrixLayout::Affine3x4);
+
+                        RunBegin = RunEnd;
+                    }
+                });
+}
+
+void luvk::TransformHierarchy::UpdateWorldMatrices()
+{
+    const auto Count = static_cast<std::uint32_t>(GetCount());
+
+    for (std::uint32_t Slot = 0U; Slot < Count; ++Slot)
+    {
+        const std::uint32_t Parent = m_OrderParents[Slot];
+
+        m_WorldDirty[Slot] |= m_LocalDirty[m_Order[Slot]] | (Parent != InvalidNode ? m_WorldDirty[Parent] : 0U);
+        m_UpdatedCount += m_WorldDirty[Slot];
+    }
+
+    for (std::size_t Level = 0U; Level + 1U < std::size(m_Levels); ++Level)
+    {
+        const std::uint32_t LevelBegin = m_Levels.at(Level);
+        const std::uint32_t LevelCount = m_Levels.at(Level + 1U) - LevelBegin;
+
+        ParallelFor(m_ThreadPoolModule.get(),
+                    LevelCount,
+                    GetParallelChunk(m_ThreadPoolModule.get(), LevelCount, m_MinNodesPerTask, TransformBatch::BlockSize),
+                    [&](const std::uint32_t Begin, const std::uint32_t End)
+                    {
+                        for (std::uint32_t Slot = LevelBegin + Begin; Slot < LevelBegin + End; ++Slot)
+                        {
+                            if (m_WorldDirty[Slot] == 0U)
+                            {
+                                continue;
+                            }
+
+                            const std::uint32_t Parent = m_OrderParents[Slot];
+                            const Matrix&       Local  = m_LocalMatrices[m_Order[Slot]];
+
+                            m_World[Slot] = Parent == InvalidNode ? Local : Multiply(m_World[Parent], Local);
+                        }
+                    });
+    }
+}